@@ -1,5 +1,6 @@
 #include "sht40x_driver_basic.h"
 
+sht40x_handle_t sht40xHandle;
 sht40x_info_t sht40xInfo;
 sht40x_data_t dataRead;
 
@@ -13,7 +14,7 @@ int err;
 int main()
 {
 
-    sht40x_basic_initialize(SHT40_AD1B_VARIANT);
+    sht40x_basic_initialize(&sht40xHandle, NULL, SHT40_AD1B_VARIANT);
     sht40x_info(&sht40xInfo);
 
     sht40x_interface_debug_print("Chip Name: \t%s\r\n", sht40xInfo.chip_name);
@@ -27,25 +28,25 @@ int main()
     sht40x_interface_debug_print("\nRecommended MCU flash: \t%dkB\r\n",sht40xInfo.flash_size_min);
     sht40x_interface_debug_print("Recommended MCU RAM: \t%dkB\r\n",sht40xInfo.ram_size_min);
 
-    err =  sht40x_basic_get_temp_rh(SHT40X_PRECISION_HIGH, &dataRead);
+    err =  sht40x_basic_get_temp_rh(&sht40xHandle, SHT40X_PRECISION_HIGH, &dataRead);
     if(err)
     {
       sht40x_interface_debug_print("failed to read\n");
     }
-    sht40x_interface_debug_print("\nTemp C: %.2f\n", dataRead.temperature_C);
-    sht40x_interface_debug_print("Temp F: %.2f\n", dataRead.temperature_F);
-    sht40x_interface_debug_print("Humidity: %.2f\n", dataRead.humidity);
+    sht40x_interface_debug_print("\nTemp C: %.2f\n", sht40x_temperature_C(&dataRead));
+    sht40x_interface_debug_print("Temp F: %.2f\n", sht40x_temperature_F(&dataRead));
+    sht40x_interface_debug_print("Humidity: %.2f\n", sht40x_humidity(&dataRead));
 
     for (int index = 0; index < RESPONSE_LENGTH; index++)
         sht40x_interface_debug_print("Raw data : %.2x\n", dataRead.rawData[index]);
 
     /**Measure Temp and humidity with n number of samples */
-    err = sht40x_basic_get_temp_humidity_nSample(SHT40X_PRECISION_HIGH, &dataRead, NumberSamples);
-    sht40x_interface_debug_print("\nTemp C sampled: %.2f\n", dataRead.temperature_C);
-    sht40x_interface_debug_print("Humidity sampled: %.2f\n", dataRead.humidity);
+    err = sht40x_basic_get_temp_humidity_nSample(&sht40xHandle, SHT40X_PRECISION_HIGH, &dataRead, NumberSamples);
+    sht40x_interface_debug_print("\nTemp C sampled: %.2f\n", sht40x_temperature_C(&dataRead));
+    sht40x_interface_debug_print("Humidity sampled: %.2f\n", sht40x_humidity(&dataRead));
 
     /** Get device unique ID */
-    err = sht40x_basic_get_serial_number((uint32_t*) &UID);
+    err = sht40x_basic_get_serial_number(&sht40xHandle, (uint32_t*) &UID);
     if(err)
     {
       /**< do something */
@@ -53,10 +54,10 @@ int main()
     sht40x_interface_debug_print("serial number : %lu\n", UID);
 
     /** Activate heater and measure temperature */
-    err = sht40x_basic_activate_heater(SHT40X_HEATER_POWER_20mW_100mS, &dataRead);
-    sht40x_interface_debug_print("\nHeater Temp C: %.2f\n", dataRead.temperature_C);
-    sht40x_interface_debug_print("Heater Temp F: %.2f\n", dataRead.temperature_F);
-    sht40x_interface_debug_print("Heater Humidity: %.2f\n", dataRead.humidity);
+    err = sht40x_basic_activate_heater(&sht40xHandle, SHT40X_HEATER_POWER_20mW_100mS, &dataRead);
+    sht40x_interface_debug_print("\nHeater Temp C: %.2f\n", sht40x_temperature_C(&dataRead));
+    sht40x_interface_debug_print("Heater Temp F: %.2f\n", sht40x_temperature_F(&dataRead));
+    sht40x_interface_debug_print("Heater Humidity: %.2f\n", sht40x_humidity(&dataRead));
     return 0;
 }
 
@@ -27,6 +27,32 @@
 
 #include "sht40x_driver.h"
 
+#ifdef SHT40X_STATS
+#define SHT40X_STATS_ADD(pHandle, FIELD, N)     ((pHandle)->stats.FIELD += (N))       /**< bump a handle counter */
+#else
+#define SHT40X_STATS_ADD(pHandle, FIELD, N)                                           /**< counters compiled out */
+#endif // SHT40X_STATS
+
+#ifdef SHT40X_TRACE
+#include "sht40x_driver_trace.h"
+#define SHT40X_TRACE_RECORD(pHandle, OP, CMD, PBUF, LEN)    a_sht40x_trace(pHandle, OP, CMD, PBUF, LEN)  /**< record a transaction */
+#else
+#define SHT40X_TRACE_RECORD(pHandle, OP, CMD, PBUF, LEN)                                                 /**< trace compiled out */
+#endif // SHT40X_TRACE
+
+#ifdef SHT40X_ALARM
+#include "sht40x_driver_alarm.h"
+#endif // SHT40X_ALARM
+
+#ifdef SHT40X_LOG
+#include "sht40x_driver_log.h"
+#define SHT40X_EVENT(pHandle, EVENT, ARG, TEXT)     a_sht40x_log(pHandle, EVENT, (uint16_t)(ARG))      /**< deferred, TEXT never reaches flash */
+#define SHT40X_EVENT_INFO(pHandle, EVENT, ARG)      a_sht40x_log(pHandle, EVENT, (uint16_t)(ARG))      /**< deferred information */
+#else
+#define SHT40X_EVENT(pHandle, EVENT, ARG, TEXT)     a_sht40x_print_error_msg(pHandle, TEXT)             /**< printed with SHT40X_DEBUG_MODE */
+#define SHT40X_EVENT_INFO(pHandle, EVENT, ARG)                                                          /**< information is only logged */
+#endif // SHT40X_LOG
+
 /**
 * @brief chip information definition
 */
@@ -43,6 +69,163 @@
 #define MCU_RAM_MIN               4                      /**< Micro-controller minimum recommended RAM size (KB)*/
 #define DRIVER_VERSION            1202                   /**< driver version */
 
+#ifdef SHT40X_CRC_TABLE
+/**
+* @brief CRC-8 lookup table, polynomial 0x31
+*/
+static uint8_t const SHT40X_CRC8_TABLE[256] = {
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D,
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB,
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13,
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95,
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6,
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17,
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2,
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A,
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC
+};
+#endif // SHT40X_CRC_TABLE
+
+#ifdef SHT40X_STATS
+/**
+* @brief This function counts a command by type
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Cmd is the command written
+* @return none
+* @note none
+*/
+static void a_sht40x_stats_command(sht40x_handle_t *const pHandle, uint8_t u8Cmd)
+{
+    switch(u8Cmd)
+    {
+        case SHT40X_MEASURE_T_RH_HIGH_PREC_CMD:      pHandle->stats.cmd_measure[SHT40X_PRECISION_HIGH]++; break;
+        case SHT40X_MEASURE_T_RH_MIDIUM_PREC_CMD:    pHandle->stats.cmd_measure[SHT40X_PRECISION_MIDIUM]++; break;
+        case SHT40X_MEASURE_T_RH_LOWEST_PREC_CMD:    pHandle->stats.cmd_measure[SHT40X_PRECISION_LOWEST]++; break;
+        case SHT40X_ACTIVATE_HEATER_200mW_1_S_CMD:   pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_200mW_1S]++; break;
+        case SHT40X_ACTIVATE_HEATER_200mW_100mS_CMD: pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_200mW_100mS]++; break;
+        case SHT40X_ACTIVATE_HEATER_110mW_1_S_CMD:   pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_110mW_1S]++; break;
+        case SHT40X_ACTIVATE_HEATER_110mW_100mS_CMD: pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_110mW_100mS]++; break;
+        case SHT40X_ACTIVATE_HEATER_20mW_1_S_CMD:    pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_20mW_1S]++; break;
+        case SHT40X_ACTIVATE_HEATER_20mW_100mS_CMD:  pHandle->stats.cmd_heater[SHT40X_HEATER_POWER_20mW_100mS]++; break;
+        case SHT40X_READ_SERIAL_NUMBER_CMD:          pHandle->stats.cmd_serial++; break;
+        case SHT40X_SOFT_RESET_CMD:                  pHandle->stats.cmd_reset++; break;
+        default: break;
+    }
+}
+#endif // SHT40X_STATS
+
+#ifdef SHT40X_TRACE
+/**
+* @brief This function records a transaction in the linked trace ring
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8OpStatus is SHT40X_TRACE_READ for a read, or'ed with the transport status
+* @param[in] u8Cmd is the command written, ignored for a read which answers the last command
+* @param[in] *pBuf point to the raw bytes
+* @param[in] u8Length is the number of bytes
+* @return none
+* @note does nothing when no ring is linked
+*/
+static void a_sht40x_trace(sht40x_handle_t *const pHandle, uint8_t u8OpStatus, uint8_t u8Cmd, const uint8_t *pBuf, uint8_t u8Length)
+{
+    uint32_t u32Timestamp = 0;
+
+    if(pHandle->pTrace == NULL)
+    {
+        return;
+    }
+    if((u8OpStatus & SHT40X_TRACE_READ) == 0)
+        pHandle->trace_cmd = u8Cmd;
+    if(pHandle->clock_now_ms != NULL)
+        u32Timestamp = pHandle->clock_now_ms(pHandle->clock);
+    else if(pHandle->get_tick_ms != NULL)
+        u32Timestamp = pHandle->get_tick_ms();
+
+    sht40x_trace_record(pHandle->pTrace, u32Timestamp, pHandle->i2c_address, u8OpStatus, pHandle->trace_cmd, pBuf, u8Length);
+}
+#endif // SHT40X_TRACE
+
+#ifdef SHT40X_LOG
+/**
+* @brief This function records an event in the linked log ring
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Event is the sht40x_log_event_t
+* @param[in] u16Argument is the event argument
+* @return none
+* @note does nothing when no ring is linked
+*/
+static void a_sht40x_log(sht40x_handle_t *const pHandle, uint8_t u8Event, uint16_t u16Argument)
+{
+    uint32_t u32Timestamp = 0;
+
+    if(pHandle->pLog == NULL)
+    {
+        return;
+    }
+    if(pHandle->clock_now_ms != NULL)
+        u32Timestamp = pHandle->clock_now_ms(pHandle->clock);
+    else if(pHandle->get_tick_ms != NULL)
+        u32Timestamp = pHandle->get_tick_ms();
+
+    sht40x_log_record(pHandle->pLog, u32Timestamp, pHandle->i2c_address, u8Event, u16Argument);
+}
+#endif // SHT40X_LOG
+
+/**
+* @brief This function accounts a command write in the statistics and the trace
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Cmd is the command written
+* @param[in] u8Status is the transport status
+* @return none
+* @note shared by the blocking transfers and sht40x_hook_write
+*/
+static void a_sht40x_account_write(sht40x_handle_t *const pHandle, uint8_t u8Cmd, uint8_t u8Status)
+{
+    (void)pHandle;
+    (void)u8Cmd;
+#ifdef SHT40X_STATS
+    a_sht40x_stats_command(pHandle, u8Cmd);
+#endif // SHT40X_STATS
+    if(u8Status != 0)
+    {
+        SHT40X_STATS_ADD(pHandle, transport_errors, 1);
+        SHT40X_TRACE_RECORD(pHandle, 1, u8Cmd, &u8Cmd, 1);
+        return;
+    }
+    SHT40X_STATS_ADD(pHandle, bytes_written, 1);
+    SHT40X_TRACE_RECORD(pHandle, 0, u8Cmd, &u8Cmd, 1);
+}
+
+/**
+* @brief This function accounts a response read in the statistics and the trace
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] *pBuf point to the bytes read
+* @param[in] u8Length is the number of bytes
+* @param[in] u8Status is the transport status
+* @return none
+* @note shared by the blocking transfers and sht40x_hook_read
+*/
+static void a_sht40x_account_read(sht40x_handle_t *const pHandle, const uint8_t *pBuf, uint8_t u8Length, uint8_t u8Status)
+{
+    (void)pHandle;
+    (void)pBuf;
+    (void)u8Length;
+    if(u8Status != 0)
+    {
+        SHT40X_STATS_ADD(pHandle, transport_errors, 1);
+        SHT40X_TRACE_RECORD(pHandle, SHT40X_TRACE_READ | 1, 0, pBuf, u8Length);
+        return;
+    }
+    SHT40X_STATS_ADD(pHandle, bytes_read, u8Length);
+    SHT40X_TRACE_RECORD(pHandle, SHT40X_TRACE_READ, 0, pBuf, u8Length);
+}
+
 /**
 * @brief i2c write byte
 * @param[in] *pHandle points to sht40x handle structure
@@ -56,10 +239,12 @@
 */
 uint8_t a_sht40x_i2c_write(sht40x_handle_t *const pHandle, uint8_t u8Reg, uint8_t *pBuf, uint8_t u8Length)
 {
-	if(pHandle->i2c_write(pHandle->i2c_address, (uint8_t*)&u8Reg, 1) != 0)
+	if(pHandle->i2c_write(pHandle->i2c_bus, pHandle->i2c_address, (uint8_t*)&u8Reg, 1) != 0)
 	{
+		a_sht40x_account_write(pHandle, u8Reg, 1);
 		return 1;                                       /**< return an error if failed to execute */
 	}
+	a_sht40x_account_write(pHandle, u8Reg, 0);
 	return 0;                                           /**< return success */
 }
 
@@ -77,19 +262,22 @@ uint8_t a_sht40x_i2c_write(sht40x_handle_t *const pHandle, uint8_t u8Reg, uint8_
 
 uint8_t a_sht40x_i2c_read(sht40x_handle_t  *const pHandle, uint8_t u8Reg, uint8_t *pBuf, uint8_t u8Length)
 {
-	if(pHandle->i2c_read(pHandle->i2c_address, (uint8_t*)pBuf, u8Length) != 0)
+	if(pHandle->i2c_read(pHandle->i2c_bus, pHandle->i2c_address, (uint8_t*)pBuf, u8Length) != 0)
 	{
+		a_sht40x_account_read(pHandle, pBuf, u8Length, 1);
 		return 1;                                       /**< return an error if failed to execute */
 	}
+	a_sht40x_account_read(pHandle, pBuf, u8Length, 0);
     return 0;                                           /**< return success */
 }
 
+#ifndef SHT40X_LOG
 /**
 * @brief This function prints the error message
 * @param[in] *pHandle points to sht40x handle structure
 * @param[in] *pBuffer point to the string to be printed
 * @return none
-* @note   none
+* @note   replaced by the deferred log with SHT40X_LOG
 */
 void a_sht40x_print_error_msg(sht40x_handle_t *const pHandle, char *const pBuffer)
 {
@@ -97,6 +285,29 @@ void a_sht40x_print_error_msg(sht40x_handle_t *const pHandle, char *const pBuffe
     pHandle->debug_print("sht40x: failed to %s.\r\n", pBuffer);
 #endif // SHT40X_DEBUG_MODE
 }
+#endif // SHT40X_LOG
+
+/**
+* @brief This function verifies the CRC of both words of a response frame
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] *pFrame point to the 6 byte frame read from the device
+* @return status code
+*          - 0 success
+*          - 5 CRC mismatch
+* @note   always succeeds when SHT40X_CRC_CHECK is not defined
+*/
+static uint8_t a_sht40x_check_frame(sht40x_handle_t *const pHandle, const uint8_t *pFrame)
+{
+#ifdef SHT40X_CRC_CHECK
+    if((sht40x_crc8(&pFrame[0], 2) != pFrame[2]) || (sht40x_crc8(&pFrame[3], 2) != pFrame[5]))
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_CRC_ERROR, ((uint16_t)pFrame[2] << 8) | pFrame[5], "check CRC");
+        SHT40X_STATS_ADD(pHandle, crc_errors, 1);
+        return SHT40X_DRV_ERR_CRC;      /**< corrupted frame */
+    }
+#endif // SHT40X_CRC_CHECK
+    return 0;                           /**< success */
+}
 
 /**
  * @brief     This function initialize the chip
@@ -113,55 +324,52 @@ uint8_t sht40x_init(sht40x_handle_t *pHandle)
 
     if(pHandle == NULL)
         return 2;     /**< return failed error */
+#ifndef SHT40X_LOG
     if(pHandle->debug_print == NULL)
         return 3;      /**< return failed error */
+#endif // SHT40X_LOG
 
-    if(pHandle->delay_ms == NULL)
+    if((pHandle->delay_ms == NULL) && (pHandle->clock_delay_ms == NULL))
     {
-#ifdef SHT40X_DEBUG_MODE
-        pHandle->debug_print("sht40x: delay_ms is null\r\n");
-#endif // SHT40X_DEBUG_MODE
+        SHT40X_EVENT(pHandle, SHT40X_LOG_LINK_MISSING, 0, "link delay_ms");
         return 3;
     }
 
     if(pHandle->i2c_init == NULL )
     {
-#ifdef SHT40X_DEBUG_MODE
-        pHandle->debug_print("sht40x: i2c_init is null\r\n");
-#endif // SHT40X_DEBUG_MODE
+        SHT40X_EVENT(pHandle, SHT40X_LOG_LINK_MISSING, 1, "link i2c_init");
         return 3;
     }
 
     if(pHandle->i2c_deinit == NULL )
     {
-#ifdef SHT40X_DEBUG_MODE
-        pHandle->debug_print("sht40x: i2c_deinit is null\r\n");
-#endif // SHT40X_DEBUG_MODE
+        SHT40X_EVENT(pHandle, SHT40X_LOG_LINK_MISSING, 2, "link i2c_deinit");
         return 3;
     }
 
     if(pHandle->i2c_read == NULL )
     {
-#ifdef SHT40X_DEBUG_MODE
-        pHandle->debug_print("sht40x: i2c_read is null\r\n");
-#endif // SHT40X_DEBUG_MODE
+        SHT40X_EVENT(pHandle, SHT40X_LOG_LINK_MISSING, 3, "link i2c_read");
         return 3;
     }
 
     if(pHandle->i2c_write == NULL )
     {
-#ifdef SHT40X_DEBUG_MODE
-        pHandle->debug_print("sht40x: i2c_write is null\r\n");
-#endif // SHT40X_DEBUG_MODE
+        SHT40X_EVENT(pHandle, SHT40X_LOG_LINK_MISSING, 4, "link i2c_write");
         return 3;
     }
 
-    if(pHandle->i2c_init())
+    if(pHandle->i2c_init(pHandle->i2c_bus))
     {
-        a_sht40x_print_error_msg(pHandle, "initialize i2c");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_I2C_INIT_FAILED, 0, "initialize i2c");
         return 1 ;
     }
+#ifdef SHT40X_STATS
+    (void)sht40x_reset_stats(pHandle);
+#endif // SHT40X_STATS
+    pHandle->serial_valid = 0;
     pHandle->inited = 1;
+    SHT40X_EVENT_INFO(pHandle, SHT40X_LOG_INIT, 0);
     return 0;                   /**< return success */
 }
 
@@ -182,9 +390,9 @@ uint8_t sht40x_deinit(sht40x_handle_t *pHandle)
     if(pHandle->inited != 1)
         return 3;      /**< return failed error */
 
-    if(pHandle->i2c_deinit() != 0)
+    if(pHandle->i2c_deinit(pHandle->i2c_bus) != 0)
     {
-        a_sht40x_print_error_msg(pHandle, "de-initialize i2c");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_I2C_DEINIT_FAILED, 0, "de-initialize i2c");
         return 1;
     }
     pHandle->inited = 0;
@@ -209,10 +417,12 @@ uint8_t sht40x_set_addr(sht40x_handle_t *const pHandle)
     if(pHandle->inited != 1)
         return 3;      /**< return failed error */
 
+    if(pHandle->i2c_address != pHandle->addres)
+        pHandle->serial_valid = 0;      /**< another device answers from now on */
     pHandle->i2c_address = pHandle->addres;
     if(pHandle->i2c_address !=  pHandle->addres)
     {
-        a_sht40x_print_error_msg(pHandle, "set i2c address");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_SET_ADDRESS_FAILED, pHandle->addres, "set i2c address");
         return 1;           /*< failed */
     }
 
@@ -240,7 +450,7 @@ uint8_t sht40x_get_addr(sht40x_handle_t *const pHandle, sht40x_i2c_address_t  *p
     *pI2c_address = (sht40x_i2c_address_t)pHandle->i2c_address;     /**< read i2c set address */
     if(*pI2c_address != pHandle->i2c_address)
     {
-        a_sht40x_print_error_msg(pHandle, "get i2c address");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_GET_ADDRESS_FAILED, 0, "get i2c address");
         return 1;           /**<failed */
     }
     return 0;               /**<success */
@@ -268,7 +478,7 @@ uint8_t sht40x_set_variant(sht40x_handle_t *const pHandle, sht40x_variant_t vari
     pHandle->variant = variant;
     if(pHandle->variant != variant)
     {
-        a_sht40x_print_error_msg(pHandle, "set device variant");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_SET_VARIANT_FAILED, variant, "set device variant");
         return 1;   /**< failed*/
     }
 
@@ -329,7 +539,7 @@ uint8_t sht40x_get_variant(sht40x_handle_t *const pHandle, sht40x_variant_t *pVa
     *pVariant = (sht40x_variant_t)pHandle->variant ;
     if(*pVariant != (sht40x_variant_t)pHandle->variant)
     {
-        a_sht40x_print_error_msg(pHandle, "get device variant");
+        SHT40X_EVENT(pHandle, SHT40X_LOG_GET_VARIANT_FAILED, 0, "get device variant");
         return 1;       /**< failed*/
     }
 
@@ -337,42 +547,22 @@ uint8_t sht40x_get_variant(sht40x_handle_t *const pHandle, sht40x_variant_t *pVa
 }
 
 /**
- * @brief     This function reads the temperature and humidity
- * @param[in] *pHandle points to the sht40x pHandler structure
- * @param[in] precision is the data read accuracy
- * @param[out] pData point to the sensor data to read
- * @return  status code
- *            - 0 success
- *            - 1 failed to get temp/humidity
- *            - 2 pHandle is NULL
- *            - 3 pHandle is not initialized
- * @note      none
- */
-uint8_t sht40x_get_temp_rh(sht40x_handle_t *const pHandle,  sht40x_precision_t precision, sht40x_data_t *pData)
+* @brief This function converts a raw measurement frame into temperature and humidity
+* @param[in] *pStatus point to the raw frame read from the device
+* @param[out] *pData point to the sensor data to fill
+* @return none
+* @note   none
+*/
+static void a_sht40x_convert(uint8_t *const pStatus, sht40x_data_t *pData)
 {
-    uint8_t err;
-    uint8_t pStatus[RESPONSE_LENGTH];
-
-    if(pHandle == NULL)
-        return 2;     /**< return failed error */
-    if(pHandle->inited != 1)
-        return 3;      /**< return failed error */
-
-    err = a_sht40x_i2c_write(pHandle, READ_PRECISION[precision], DUMMY_DATA, 0);
-    if(err != SHT40X_DRV_OK)
-    {
-        a_sht40x_print_error_msg(pHandle, "write temp and humidity cmd");
-        return err;  /**< failed*/
-    }
-
-    pHandle->delay_ms(10);      /**< wait 10 ms for conversion to complete */
-
-    err = a_sht40x_i2c_read(pHandle, DUMMY_DATA, (uint8_t *)pStatus, RESPONSE_LENGTH);  /**< read result */
-    if(err != SHT40X_DRV_OK)
-    {
-        a_sht40x_print_error_msg(pHandle, "read temp and humidity");
-        return err;  /**< failed*/
-    }
+#ifdef SHT40X_FIXED_POINT
+    uint16_t u16Temperature = ((uint16_t)pStatus[0] << 8) | pStatus[1];
+    uint16_t u16Humidity = ((uint16_t)pStatus[3] << 8) | pStatus[4];
+
+    pData->temperature_mC = sht40x_convert_temperature_mC(u16Temperature);
+    pData->temperature_mF = sht40x_convert_temperature_mF(u16Temperature);
+    pData->humidity_mRH = sht40x_convert_humidity_mRH(u16Humidity);          /**< clamped to 0 .. 100 %RH */
+#else
     pData->temperature_C = (pStatus[0] << 8) |  pStatus[1];
     pData->temperature_C = ((pData->temperature_C/65535.0) * 175) - 45;
     pData->temperature_F = (pData->temperature_C * 9/5) + 32;
@@ -383,156 +573,1570 @@ uint8_t sht40x_get_temp_rh(sht40x_handle_t *const pHandle,  sht40x_precision_t p
         /**error handler***/
     pData->humidity =  pData->humidity > HUMIDITY_MAX ? HUMIDITY_MAX: pData->humidity;                     /**< if humidity is high than max allowed, set to 100 */
     pData->humidity =  pData->humidity < HUMIDITY_MIN ? HUMIDITY_MIN:  pData->humidity;                    /**< if humidity is less than min allowed, set to 0 */
+#endif // SHT40X_FIXED_POINT
 
     memcpy(pData->rawData, pStatus, RESPONSE_LENGTH);
-
-    return 0;
 }
 
 /**
- * @brief     This function get the device serial number
- * @param[in] *pHandle points to sht40x pHandle structure
- * @param[out] pSerial_Number point to the device serial number
- * @return  status code
- *            - 0 success
- *            - 1 failed to get S/N
- *            - 2 pHandle is NULL
- *            - 3 pHandle is not initialized
- * @note      none
- */
-uint8_t sht40x_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSerial_Number)
+* @brief This function waits through the linked clock
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u32Time_ms is the time to wait in milliseconds
+* @return none
+* @note   clock_delay_ms when linked, delay_ms otherwise
+*/
+static void a_sht40x_delay_ms(sht40x_handle_t *const pHandle, uint32_t u32Time_ms)
 {
-    uint8_t err;
-    uint8_t temp_data[4];         /**< temporary data to hold serial number */
-    uint8_t count = 3;
-    uint8_t dataOut[4];
-    int index;
-
-    if(pHandle == NULL)
-        return 2;     /**< return failed error */
-    if(pHandle->inited != 1)
-        return 3;      /**< return failed error */
-
-    memset(temp_data, 0, 4);
-
-     err = a_sht40x_i2c_write(pHandle, SHT40X_READ_SERIAL_NUMBER_CMD, DUMMY_DATA, 0);
-    if(err != SHT40X_DRV_OK)
+    SHT40X_STATS_ADD(pHandle, delay_ms, u32Time_ms);
+    if(pHandle->clock_delay_ms != NULL)
     {
-        a_sht40x_print_error_msg(pHandle, "write UID cmd");
-        return err;  /**< failed*/
+        pHandle->clock_delay_ms(pHandle->clock, u32Time_ms);
+        return;
     }
+    pHandle->delay_ms(u32Time_ms);
+}
 
-    pHandle->delay_ms(10);
+/**
+* @brief This function tells whether a time source is linked
+* @param[in] *pHandle points to sht40x handle structure
+* @return 1 when clock_now_ms or get_tick_ms is linked, 0 otherwise
+* @note   none
+*/
+static uint8_t a_sht40x_has_clock(sht40x_handle_t *const pHandle)
+{
+    return ((pHandle->clock_now_ms != NULL) || (pHandle->get_tick_ms != NULL)) ? 1 : 0;
+}
 
-    err = a_sht40x_i2c_read(pHandle, DUMMY_DATA, (uint8_t *)temp_data, RESPONSE_LENGTH);
-    if(err != SHT40X_DRV_OK)
+/**
+* @brief This function reads the linked time source
+* @param[in] *pHandle points to sht40x handle structure
+* @return time in milliseconds
+* @note   clock_now_ms when linked, get_tick_ms otherwise, only valid when a_sht40x_has_clock
+*/
+static uint32_t a_sht40x_now_ms(sht40x_handle_t *const pHandle)
+{
+    if(pHandle->clock_now_ms != NULL)
     {
-        a_sht40x_print_error_msg(pHandle, "get UID");
-        return err;  /**< failed*/
+        return pHandle->clock_now_ms(pHandle->clock);
     }
+    return pHandle->get_tick_ms();
+}
 
-	temp_data[2] = temp_data[3];
-	temp_data[3] = temp_data[4];
-
-  for( index = 0; index < 4; ++index)
+#ifdef SHT40X_STATS
+/**
+* @brief This function marks the start of a blocking call
+* @param[in] *pHandle points to sht40x handle structure
+* @return mark to pass to a_sht40x_stats_latency
+* @note the clock when linked, the total time waited otherwise
+*/
+static uint32_t a_sht40x_stats_mark(sht40x_handle_t *const pHandle)
+{
+    if(a_sht40x_has_clock(pHandle) == 1)
     {
-        dataOut[count] = temp_data[index];     /**< move data into a temporarily buffer in reverse order*/
-        count--;
+        return a_sht40x_now_ms(pHandle);
     }
-   memcpy(serial.pBuffer, dataOut, 4);
-  *pSerial_Number = serial.raw;
-
-    return 0;           /**< success */
+    return pHandle->stats.delay_ms;
 }
 
 /**
- * @brief     This function activate the device heater
- * @param[in] *pHandle points to sht40x pHandle structure
- * @param[in]  power is the heater power desired
- * @param[out] pData point to the sensor data to read
- * @return  status code
- *            - 0 success
- *            - 1 failed activate heater
- *            - 2 pHandle is NULL
- *            - 3 pHandle is not initialized
- * @note      Depending on heater setting selected, this routine can take up to 1000 ms delay
- */
-uint8_t sht40x_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power, sht40x_data_t *pData)
+* @brief This function accounts the latency of a blocking call
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u32Mark is the value returned by a_sht40x_stats_mark at the start of the call
+* @return none
+* @note none
+*/
+static void a_sht40x_stats_latency(sht40x_handle_t *const pHandle, uint32_t u32Mark)
 {
+    uint32_t u32Latency = a_sht40x_stats_mark(pHandle) - u32Mark;
 
-    uint8_t err;
-    uint8_t pStatus[RESPONSE_LENGTH];
+    if(u32Latency > 0xFFFFUL)
+        u32Latency = 0xFFFFUL;
 
-    if(pHandle == NULL)
-        return 2;     /**< return failed error */
-    if(pHandle->inited != 1)
-        return 3;      /**< return failed error */
+    pHandle->stats.calls++;
+    pHandle->stats.latency_total_ms += u32Latency;
+    if(u32Latency < pHandle->stats.latency_min_ms)
+        pHandle->stats.latency_min_ms = (uint16_t)u32Latency;
+    if(u32Latency > pHandle->stats.latency_max_ms)
+        pHandle->stats.latency_max_ms = (uint16_t)u32Latency;
+}
+#endif // SHT40X_STATS
 
-    err = a_sht40x_i2c_write(pHandle, HEATER_POWER[power], DUMMY_DATA, 0);
-    if(err != SHT40X_DRV_OK)
+/**
+* @brief This function waits on behalf of the pending command
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u16Time_ms is the time to wait in milliseconds
+* @return none
+* @note   the waited time is accounted so fetch can time out without a tick source
+*/
+static void a_sht40x_pending_delay(sht40x_handle_t *const pHandle, uint16_t u16Time_ms)
+{
+    a_sht40x_delay_ms(pHandle, u16Time_ms);
+    pHandle->pending_waited += u16Time_ms;
+}
+
+/**
+* @brief This function returns the time elapsed since the pending command was issued
+* @param[in] *pHandle points to sht40x handle structure
+* @return elapsed time in milliseconds
+* @note   uses the tick source when linked. Otherwise the time waited by the blocking calls, or
+*         MEASUREMENT_POLL_DELAY per busy NACK when larger, so a caller polling a dead device
+*         without any delay still reaches the end of the NACK window.
+*/
+static uint32_t a_sht40x_pending_elapsed(sht40x_handle_t *const pHandle)
+{
+    uint32_t u32Polled;
+
+    if(a_sht40x_has_clock(pHandle) == 1)
     {
-        a_sht40x_print_error_msg(pHandle, "write heater cmd");
-        return err;  /**< failed*/
+        return (uint32_t)(a_sht40x_now_ms(pHandle) - pHandle->pending_tick);
     }
+    u32Polled = (uint32_t)pHandle->pending_nacks * MEASUREMENT_POLL_DELAY;
+    return (u32Polled > pHandle->pending_waited) ? u32Polled : pHandle->pending_waited;
+}
 
-    if((power == SHT40X_HEATER_POWER_200mW_1S) || (power == SHT40X_HEATER_POWER_110mW_1S) || (power == SHT40X_HEATER_POWER_20mW_1S))
-        pHandle->delay_ms(HEATER_DELAY_1S);
-    else
-     pHandle->delay_ms(HEATER_DELAY_100mS);
+/**
+* @brief This function writes a command whose response is read later
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Cmd is the command to write
+* @param[in] u8Index is the command index in its table (precision or heater power)
+* @param[in] u16Delay_ms is the maximum time the device needs before the response is ready
+* @return status code
+*          - 0 success
+*          - 1 failed to write
+* @note none
+*/
+static uint8_t a_sht40x_start(sht40x_handle_t *const pHandle, uint8_t u8Cmd, uint8_t u8Index, uint16_t u16Delay_ms)
+{
+    uint8_t err;
 
-    err = a_sht40x_i2c_read(pHandle, DUMMY_DATA, (uint8_t *)pStatus, RESPONSE_LENGTH);
+    err = a_sht40x_i2c_write(pHandle, u8Cmd, DUMMY_DATA, 0);
     if(err != SHT40X_DRV_OK)
     {
-        a_sht40x_print_error_msg(pHandle, "read temp and humidity");
+        pHandle->pending_cmd = 0;
         return err;  /**< failed*/
     }
 
-    pData->temperature_C = (pStatus[0] << 8) |  pStatus[1];
-    pData->temperature_C = ((pData->temperature_C/65535.0) * 175) - 45;
-    pData->temperature_F = (pData->temperature_C * 9/5) + 32;
+    pHandle->pending_cmd = u8Cmd;
+    pHandle->pending_index = u8Index;
+    pHandle->pending_delay = u16Delay_ms;
+    pHandle->pending_nacks = 0;
+    pHandle->pending_waited = 0;
+    if(a_sht40x_has_clock(pHandle) == 1)
+    {
+        pHandle->pending_tick = a_sht40x_now_ms(pHandle);   /**< remember when the command was issued */
+    }
 
-    pData->humidity = (pStatus[3] << 8) | pStatus[4];
-    pData->humidity = ((pData->humidity/65535.0) * 125) - 6;
+    return 0;   /**< success */
+}
 
-    memcpy(pData->rawData, pStatus, RESPONSE_LENGTH);
+/**
+* @brief This function reads and checks the response of the pending command
+* @param[in] *pHandle points to sht40x handle structure
+* @param[out] *pStatus point to the 6 byte response
+* @param[in] u32Earliest is the elapsed time before which the bus is not touched when a tick source is linked
+* @param[in] u8NackIsBusy tells a failed read means "not ready" until pending_delay plus margin elapsed
+* @param[out] *pElapsed point to the time elapsed since the command was issued
+* @return status code
+*          - 0 success
+*          - 1 failed to read
+*          - 4 response not ready yet
+*          - 5 CRC mismatch
+* @note the pending command is cleared unless status 4 is returned
+*/
+static uint8_t a_sht40x_fetch(sht40x_handle_t *const pHandle, uint8_t *pStatus, uint32_t u32Earliest, uint8_t u8NackIsBusy, uint32_t *pElapsed)
+{
+    uint8_t err;
+    uint32_t u32Elapsed = a_sht40x_pending_elapsed(pHandle);
 
-    /**error handler***/
+    *pElapsed = u32Elapsed;
+    if((a_sht40x_has_clock(pHandle) == 1) && (u32Elapsed < u32Earliest))
+    {
+        return SHT40X_DRV_NOT_READY;    /**< device still busy */
+    }
 
-    pData->humidity =  pData->humidity > HUMIDITY_MAX ? HUMIDITY_MAX: pData->humidity;                     /**< if humidity is high than max allowed, set to 100 */
-    pData->humidity =  pData->humidity < HUMIDITY_MIN ? HUMIDITY_MIN:  pData->humidity;                     /**< if humidity is less than min allowed, set to 0 */
+    err = a_sht40x_i2c_read(pHandle, DUMMY_DATA, pStatus, RESPONSE_LENGTH);
+    if(err != SHT40X_DRV_OK)
+    {
+        if((u8NackIsBusy == 1) && (u32Elapsed <= ((uint32_t)pHandle->pending_delay + MEASUREMENT_POLL_MARGIN)))
+        {
+            if(pHandle->pending_nacks < 0xFFFFU)
+                pHandle->pending_nacks++;
+            SHT40X_STATS_ADD(pHandle, busy_nacks, 1);
+            SHT40X_EVENT_INFO(pHandle, SHT40X_LOG_BUSY_NACK, (uint16_t)u32Elapsed);
+            return SHT40X_DRV_NOT_READY;    /**< address NACKed, device still busy */
+        }
+        pHandle->pending_cmd = 0;
+        return err;  /**< failed*/
+    }
+    pHandle->pending_cmd = 0;
 
-    return 0;
+    return a_sht40x_check_frame(pHandle, pStatus);
 }
 
 /**
- * @brief     This function soft reset the device
- * @param[in] *pHandle points to sht40x pHandle structure
- * @return  status code
- *            - 0 success
- *            - 1 failed to reset
- *            - 2 pHandle is NULL
- *            - 3 pHandle is not initialized
- * @note      none
- */
-uint8_t sht40x_soft_reset(sht40x_handle_t *const pHandle)
+* @brief This function processes a checked measurement frame
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Precision is the precision of the measurement
+* @param[in] *pStatus point to the 6 byte frame
+* @param[in] u32Elapsed is the time elapsed between the command and the read
+* @param[in] u8Nacked tells a read of this measurement was NACKed before
+* @return none
+* @note runs the alarm and learns the conversion time in ready polling mode
+*/
+static void a_sht40x_measured(sht40x_handle_t *const pHandle, uint8_t u8Precision, const uint8_t *pStatus, uint32_t u32Elapsed, uint8_t u8Nacked)
 {
-    uint8_t err;
+#ifdef SHT40X_ALARM
+    if(pHandle->pAlarm != NULL)
+    {
+        sht40x_ticks_t ticks;
 
-    if(pHandle == NULL)
-        return 2;     /**< return failed error */
-    if(pHandle->inited != 1)
-        return 3;      /**< return failed error */
+        ticks.temperature = ((uint16_t)pStatus[0] << 8) | pStatus[1];
+        ticks.humidity = ((uint16_t)pStatus[3] << 8) | pStatus[4];
+        (void)sht40x_alarm_process(pHandle->pAlarm, &ticks);      /**< limits compared on ticks, before any conversion */
+    }
+#else
+    (void)pStatus;
+#endif // SHT40X_ALARM
 
-    err = a_sht40x_i2c_write(pHandle, SHT40X_SOFT_RESET_CMD, DUMMY_DATA, 0);
-    if(err != SHT40X_DRV_OK)
+    if(pHandle->ready_poll == 1)
     {
-        a_sht40x_print_error_msg(pHandle, "to reset");
-        return err;     /**< failed */
+        /** a read right after a NACK bounds the conversion time tightly, a first-try read only from above */
+        if((u8Nacked != 0) || (pHandle->conversion_ms[u8Precision] == 0) || (u32Elapsed < pHandle->conversion_ms[u8Precision]))
+        {
+            if(u32Elapsed > MEASUREMENT_DELAY[u8Precision])
+                u32Elapsed = MEASUREMENT_DELAY[u8Precision];
+            if(u32Elapsed == 0)
+                u32Elapsed = MEASUREMENT_POLL_DELAY;
+            pHandle->conversion_ms[u8Precision] = (uint8_t)u32Elapsed;
+        }
     }
-
-    return 0;           /**< success */
 }
 
+/**
+* @brief This function reads and checks the frame of the pending measurement
+* @param[in] *pHandle points to sht40x handle structure
+* @param[out] *pStatus point to the 6 byte frame
+* @return status code
+*          - 0 success
+*          - 1 failed to read or no measurement started
+*          - 4 measurement not ready yet
+*          - 5 CRC mismatch
+* @note the conversion time is learned here in ready polling mode
+*/
+static uint8_t a_sht40x_fetch_measurement(sht40x_handle_t *const pHandle, uint8_t *pStatus)
+{
+    uint8_t err;
+    uint32_t u32Elapsed;
+    uint8_t u8Precision;
+
+    u8Precision = pHandle->pending_index;
+    if((pHandle->pending_cmd == 0) || (u8Precision > SHT40X_PRECISION_LOWEST) || (pHandle->pending_cmd != READ_PRECISION[u8Precision]))
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_NO_MEASUREMENT, pHandle->pending_cmd, "fetch, no measurement started");
+        return 1;   /**< failed */
+    }
+
+    if(pHandle->ready_poll == 1)
+        err = a_sht40x_fetch(pHandle, pStatus, 0, 1, &u32Elapsed);                          /**< read early, a NACK means busy */
+    else
+        err = a_sht40x_fetch(pHandle, pStatus, pHandle->pending_delay, 0, &u32Elapsed);     /**< read after the max conversion time */
+    if(err == SHT40X_DRV_NOT_READY)
+    {
+        return err;     /**< conversion still running */
+    }
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_MEASURE_READ_FAILED, u8Precision, "read temp and humidity");
+        return err;  /**< failed*/
+    }
+
+    a_sht40x_measured(pHandle, u8Precision, pStatus, u32Elapsed, (pHandle->pending_nacks != 0) ? 1 : 0);
+
+    return 0;   /**< success */
+}
+
+/**
+* @brief This function runs a blocking measurement up to the checked raw frame
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] precision is the data read accuracy
+* @param[out] *pStatus point to the 6 byte frame
+* @return status code
+*          - 0 success
+*          - 1 failed
+*          - 2 pHandle is NULL
+*          - 3 pHandle is not initialized
+*          - 5 CRC mismatch
+* @note shared by sht40x_get_temp_rh and sht40x_read_ticks
+*/
+static uint8_t a_sht40x_measure(sht40x_handle_t *const pHandle, sht40x_precision_t precision, uint8_t *pStatus)
+{
+    uint8_t err;
+    uint8_t u8Wait;
+#ifdef SHT40X_STATS
+    uint32_t u32Mark;
+#endif // SHT40X_STATS
+
+    err = sht40x_start_measurement(pHandle, precision);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+#ifdef SHT40X_STATS
+    u32Mark = a_sht40x_stats_mark(pHandle);
+#endif // SHT40X_STATS
+
+    if((pHandle->ready_poll == 1) && (pHandle->conversion_ms[precision] == 0))
+        u8Wait = MEASUREMENT_POLL_DELAY;                    /**< conversion time not learned yet, start polling early */
+    else
+        (void)sht40x_get_conversion_time(pHandle, precision, &u8Wait);
+
+    a_sht40x_pending_delay(pHandle, u8Wait);      /**< wait for conversion to complete */
+
+    err = a_sht40x_fetch_measurement(pHandle, pStatus);
+    while(err == SHT40X_DRV_NOT_READY)
+    {
+        a_sht40x_pending_delay(pHandle, MEASUREMENT_POLL_DELAY);      /**< not ready yet, wait a little longer */
+        err = a_sht40x_fetch_measurement(pHandle, pStatus);
+    }
+#ifdef SHT40X_STATS
+    a_sht40x_stats_latency(pHandle, u32Mark);
+#endif // SHT40X_STATS
+
+    return err;
+}
+
+/**
+ * @brief     This function reads the temperature and humidity
+ * @param[in] *pHandle points to the sht40x pHandler structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
+ * @note      blocking wrapper around sht40x_start_measurement and sht40x_fetch_measurement
+ */
+uint8_t sht40x_get_temp_rh(sht40x_handle_t *const pHandle,  sht40x_precision_t precision, sht40x_data_t *pData)
+{
+    uint8_t err;
+    uint8_t pStatus[RESPONSE_LENGTH];
+
+    err = a_sht40x_measure(pHandle, precision, pStatus);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+
+    a_sht40x_convert(pStatus, pData);
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function reads the raw temperature and humidity ticks
+ * @param[in] *pHandle points to the sht40x pHandler structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
+ * @note      same sequence as sht40x_get_temp_rh without any conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_read_ticks(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_ticks_t *pTicks)
+{
+    uint8_t err;
+    uint8_t pStatus[RESPONSE_LENGTH];
+
+    err = a_sht40x_measure(pHandle, precision, pStatus);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+
+    pTicks->temperature = ((uint16_t)pStatus[0] << 8) | pStatus[1];
+    pTicks->humidity = ((uint16_t)pStatus[3] << 8) | pStatus[4];
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function starts a temperature and humidity measurement without waiting for it
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to write measurement command or invalid precision
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      call sht40x_fetch_measurement once the conversion time elapsed
+ */
+uint8_t sht40x_start_measurement(sht40x_handle_t *const pHandle, sht40x_precision_t precision)
+{
+    uint8_t err;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    if(precision > SHT40X_PRECISION_LOWEST)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_INVALID_PRECISION, precision, "start measurement, invalid precision");
+        return 1;   /**< failed */
+    }
+
+    err = a_sht40x_start(pHandle, READ_PRECISION[precision], precision, MEASUREMENT_DELAY[precision]);
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_MEASURE_CMD_FAILED, precision, "write temp and humidity cmd");
+        return err;  /**< failed*/
+    }
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function fetches the result of a measurement started with sht40x_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity or no measurement started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 measurement not ready yet, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      status 4 is only reported when a clock or get_tick_ms function is linked or in ready
+ *            polling mode, otherwise the caller is responsible for waiting the conversion time
+ */
+uint8_t sht40x_fetch_measurement(sht40x_handle_t *const pHandle, sht40x_data_t *pData)
+{
+    uint8_t err;
+    uint8_t pStatus[RESPONSE_LENGTH];
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    err = a_sht40x_fetch_measurement(pHandle, pStatus);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed or not ready */
+    }
+
+    a_sht40x_convert(pStatus, pData);
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function fetches the raw ticks of a measurement started with sht40x_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity or no measurement started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 measurement not ready yet, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      same rules as sht40x_fetch_measurement without any conversion
+ */
+uint8_t sht40x_fetch_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks)
+{
+    uint8_t err;
+    uint8_t pStatus[RESPONSE_LENGTH];
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    err = a_sht40x_fetch_measurement(pHandle, pStatus);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed or not ready */
+    }
+
+    pTicks->temperature = ((uint16_t)pStatus[0] << 8) | pStatus[1];
+    pTicks->humidity = ((uint16_t)pStatus[3] << 8) | pStatus[4];
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function reads the temperature and humidity of a group of sensors in one round
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      the measure command is written to every sensor back to back, the slowest
+ *            conversion time is waited once, then every sensor is read. The first linked
+ *            handle's delay function is used for the shared wait.
+ */
+uint8_t sht40x_group_get_temp_rh(sht40x_handle_t *const pHandles[], uint8_t u8Count, sht40x_precision_t precision,
+                                 sht40x_data_t *pData, uint8_t *pStatus)
+{
+    return sht40x_group_get_temp_rh_ordered(pHandles, u8Count, NULL, precision, pData, pStatus);
+}
+
+/**
+ * @brief     This function reads a group of sensors in one round, visiting them in a given order
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] *pOrder is a permutation of 0 .. u8Count - 1, NULL for the array order
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      with pOrder, commands are written in that order and read back in reverse, so the sensors
+ *            started last are read first. pData and pStatus stay indexed like pHandles.
+ */
+uint8_t sht40x_group_get_temp_rh_ordered(sht40x_handle_t *const pHandles[], uint8_t u8Count, const uint8_t *pOrder,
+                                         sht40x_precision_t precision, sht40x_data_t *pData, uint8_t *pStatus)
+{
+    uint8_t err;
+    uint8_t step;
+    uint8_t index;
+    uint8_t u8Wait;
+    uint8_t u8MaxWait = 0;
+    uint8_t u8Failed = 0;
+    sht40x_handle_t *pWaiter = NULL;
+
+    if((pHandles == NULL) || (pData == NULL) || (u8Count == 0))
+        return 2;     /**< return failed error */
+
+    /** phase 1: issue the measure command to every sensor */
+    for(step = 0; step < u8Count; step++)
+    {
+        index = (pOrder == NULL) ? step : pOrder[step];
+        err = sht40x_start_measurement(pHandles[index], precision);
+        if(err == SHT40X_DRV_OK)
+        {
+            if((pHandles[index]->ready_poll == 1) && (pHandles[index]->conversion_ms[precision] == 0))
+                u8Wait = MEASUREMENT_DELAY[precision];                  /**< nothing learned yet, assume the worst case */
+            else
+                (void)sht40x_get_conversion_time(pHandles[index], precision, &u8Wait);
+            u8MaxWait = u8Wait > u8MaxWait ? u8Wait : u8MaxWait;
+            if(pWaiter == NULL)
+                pWaiter = pHandles[index];
+        }
+        if(pStatus != NULL)
+            pStatus[index] = err;
+    }
+
+    if(pWaiter == NULL)
+    {
+        return 1;      /**< no sensor started */
+    }
+
+    /** phase 2: one wait for the slowest conversion */
+    a_sht40x_delay_ms(pWaiter, u8MaxWait);
+
+    /** phase 3: read every started sensor */
+    for(step = 0; step < u8Count; step++)
+    {
+        index = (pOrder == NULL) ? step : pOrder[u8Count - 1 - step];
+        if((pHandles[index] == NULL) || (pHandles[index]->pending_cmd == 0))
+        {
+            u8Failed = 1;                   /**< not started */
+            continue;
+        }
+
+        pHandles[index]->pending_waited += u8MaxWait;
+        err = sht40x_fetch_measurement(pHandles[index], &pData[index]);
+        while(err == SHT40X_DRV_NOT_READY)
+        {
+            a_sht40x_pending_delay(pHandles[index], MEASUREMENT_POLL_DELAY);      /**< not ready yet, wait a little longer */
+            err = sht40x_fetch_measurement(pHandles[index], &pData[index]);
+        }
+        if(err != SHT40X_DRV_OK)
+            u8Failed = 1;
+        if(pStatus != NULL)
+            pStatus[index] = err;
+    }
+
+    return u8Failed;
+}
+
+/**
+ * @brief     This function enables or disables the ready polling mode
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] enable is the ready polling state
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      in ready polling mode a NACKed result read is treated as "not ready" until the
+ *            datasheet max conversion time plus MEASUREMENT_POLL_MARGIN elapsed, and the
+ *            conversion time of the device is learned from the first successful read. Without
+ *            a clock or get_tick_ms function linked, each NACK counts as MEASUREMENT_POLL_DELAY
+ *            ms: poll sht40x_fetch_measurement no more often than that.
+ */
+uint8_t sht40x_set_ready_poll(sht40x_handle_t *const pHandle, sht40x_bool_t enable)
+{
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    pHandle->ready_poll = (enable == SHT40X_BOOL_TRUE) ? 1 : 0;
+    memset(pHandle->conversion_ms, 0, sizeof(pHandle->conversion_ms));      /**< forget the learned conversion times */
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function get the ready polling mode state
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pEnable point to the ready polling state
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      none
+ */
+uint8_t sht40x_get_ready_poll(sht40x_handle_t *const pHandle, sht40x_bool_t *pEnable)
+{
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    *pEnable = (pHandle->ready_poll == 1) ? SHT40X_BOOL_TRUE : SHT40X_BOOL_FALSE;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function get the conversion time to wait for a precision
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTime_ms point to the conversion time in milliseconds
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid precision
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      returns the learned time in ready polling mode, the datasheet maximum otherwise
+ */
+uint8_t sht40x_get_conversion_time(sht40x_handle_t *const pHandle, sht40x_precision_t precision, uint8_t *pTime_ms)
+{
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    if(precision > SHT40X_PRECISION_LOWEST)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_INVALID_PRECISION, precision, "get conversion time, invalid precision");
+        return 1;   /**< failed */
+    }
+
+    if((pHandle->ready_poll == 1) && (pHandle->conversion_ms[precision] != 0))
+        *pTime_ms = pHandle->conversion_ms[precision];     /**< learned from the device */
+    else
+        *pTime_ms = MEASUREMENT_DELAY[precision];          /**< datasheet maximum */
+
+    return 0;   /**< success */
+}
+
+/**
+* @brief This function reads the answer of the serial number command into the cache
+* @param[in] *pHandle points to sht40x handle structure
+* @return status code
+*          - 0 success
+*          - 1 failed to read
+*          - 5 CRC mismatch
+* @note shared by sht40x_get_serial_number and sht40x_poll
+*/
+static uint8_t a_sht40x_read_serial(sht40x_handle_t *const pHandle)
+{
+    uint8_t err;
+    uint8_t temp_data[RESPONSE_LENGTH];         /**< serial number words and their CRC */
+
+    err = a_sht40x_i2c_read(pHandle, DUMMY_DATA, temp_data, RESPONSE_LENGTH);
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_SERIAL_READ_FAILED, 0, "get UID");
+        return err;  /**< failed*/
+    }
+
+    err = a_sht40x_check_frame(pHandle, temp_data);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+
+    /** word 0 is the upper half, each word is sent MSB first, CRC bytes 2 and 5 are skipped */
+    pHandle->serial_number = ((uint32_t)temp_data[0] << 24) | ((uint32_t)temp_data[1] << 16) |
+                             ((uint32_t)temp_data[3] << 8) | (uint32_t)temp_data[4];
+    pHandle->serial_valid = 1;
+
+    return 0;           /**< success */
+}
+
+/**
+ * @brief     This function get the device serial number
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pSerial_Number point to the device serial number
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get S/N
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
+ * @note      read from the device once, then served from the handle until sht40x_init or an
+ *            address change through sht40x_set_addr
+ */
+uint8_t sht40x_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSerial_Number)
+{
+    uint8_t err;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    if(pHandle->serial_valid == 1)
+    {
+        *pSerial_Number = pHandle->serial_number;     /**< read once per device */
+        return 0;
+    }
+
+    err = a_sht40x_i2c_write(pHandle, SHT40X_READ_SERIAL_NUMBER_CMD, DUMMY_DATA, 0);
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_SERIAL_CMD_FAILED, 0, "write UID cmd");
+        return err;  /**< failed*/
+    }
+
+    a_sht40x_delay_ms(pHandle, SERIAL_NUMBER_DELAY);
+
+    err = a_sht40x_read_serial(pHandle);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+    *pSerial_Number = pHandle->serial_number;
+
+    return 0;           /**< success */
+}
+
+/**
+ * @brief     This function activate the device heater
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in]  power is the heater power desired
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed activate heater or invalid power
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
+ * @note      Depending on heater setting selected, this routine can take up to 1000 ms delay,
+ *            see sht40x_start_heater for the non-blocking version
+ */
+uint8_t sht40x_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power, sht40x_data_t *pData)
+{
+    uint8_t err;
+#ifdef SHT40X_STATS
+    uint32_t u32Mark;
+#endif // SHT40X_STATS
+
+    err = sht40x_start_heater(pHandle, power);
+    if(err != SHT40X_DRV_OK)
+    {
+        return err;  /**< failed*/
+    }
+#ifdef SHT40X_STATS
+    u32Mark = a_sht40x_stats_mark(pHandle);
+#endif // SHT40X_STATS
+
+    a_sht40x_pending_delay(pHandle, HEATER_DELAY[power]);      /**< wait for the heater pulse and the measurement */
+
+    err = sht40x_fetch_heater(pHandle, pData);
+    while(err == SHT40X_DRV_NOT_READY)
+    {
+        a_sht40x_pending_delay(pHandle, MEASUREMENT_POLL_DELAY);      /**< not done yet, wait a little longer */
+        err = sht40x_fetch_heater(pHandle, pData);
+    }
+#ifdef SHT40X_STATS
+    a_sht40x_stats_latency(pHandle, u32Mark);
+#endif // SHT40X_STATS
+
+    return err;
+}
+
+/**
+ * @brief     This function starts a heater pulse without waiting for it
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in]  power is the heater power desired
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to write heater command or invalid power
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      returns right away, the bus stays free for other devices during the pulse.
+ *            Call sht40x_fetch_heater periodically to collect the result.
+ */
+uint8_t sht40x_start_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power)
+{
+    uint8_t err;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    if(power > SHT40X_HEATER_POWER_20mW_100mS)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_INVALID_HEATER_POWER, power, "start heater, invalid power");
+        return 1;   /**< failed */
+    }
+
+    err = a_sht40x_start(pHandle, HEATER_POWER[power], power, HEATER_DELAY[power]);
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_HEATER_CMD_FAILED, power, "write heater cmd");
+        return err;  /**< failed*/
+    }
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function collects the measurement taken at the end of a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to read or no heater pulse started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 heater pulse still running, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      with a clock or get_tick_ms function linked the bus is not touched before the pulse ends,
+ *            otherwise a NACKed read is reported as status 4, each one counting as
+ *            MEASUREMENT_POLL_DELAY ms, until the pulse time plus MEASUREMENT_POLL_MARGIN
+ *            elapsed. The heater callback, when
+ *            linked, is called once with the final status, and with pData only when it is 0.
+ */
+uint8_t sht40x_fetch_heater(sht40x_handle_t *const pHandle, sht40x_data_t *pData)
+{
+    uint8_t err;
+    uint8_t pStatus[RESPONSE_LENGTH];
+    uint32_t u32Elapsed;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    if((pHandle->pending_cmd == 0) || (pHandle->pending_index > SHT40X_HEATER_POWER_20mW_100mS) || (pHandle->pending_cmd != HEATER_POWER[pHandle->pending_index]))
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_NO_HEATER, pHandle->pending_cmd, "fetch heater, no heater started");
+        return 1;   /**< failed */
+    }
+
+    err = a_sht40x_fetch(pHandle, pStatus, pHandle->pending_delay, 1, &u32Elapsed);
+    if(err == SHT40X_DRV_NOT_READY)
+    {
+        return err;     /**< heater pulse still running */
+    }
+
+    if(err == SHT40X_DRV_OK)
+    {
+        a_sht40x_convert(pStatus, pData);
+    }
+    else
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_HEATER_READ_FAILED, pHandle->pending_index, "read temp and humidity");
+    }
+
+    if(pHandle->heater_callback != NULL)
+    {
+        pHandle->heater_callback(pHandle, err, (err == SHT40X_DRV_OK) ? pData : NULL);     /**< report completion, no data on failure */
+    }
+
+    return err;
+}
+
+/**
+ * @brief     This function soft reset the device
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to reset
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      waits the 1 ms the device needs before it accepts a new command
+ */
+uint8_t sht40x_soft_reset(sht40x_handle_t *const pHandle)
+{
+    uint8_t err;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->inited != 1)
+        return 3;      /**< return failed error */
+
+    err = a_sht40x_i2c_write(pHandle, SHT40X_SOFT_RESET_CMD, DUMMY_DATA, 0);
+    if(err != SHT40X_DRV_OK)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_RESET_FAILED, 0, "to reset");
+        return err;     /**< failed */
+    }
+
+    a_sht40x_delay_ms(pHandle, SOFT_RESET_DELAY);       /**< the device NACKs until the reset completes */
+    pHandle->pending_cmd = 0;
+    SHT40X_EVENT_INFO(pHandle, SHT40X_LOG_RESET, 0);
+
+    return 0;           /**< success */
+}
+
+/**
+* @brief This function finds a command in a command table
+* @param[in] u8Cmd is the command
+* @param[in] *pTable point to READ_PRECISION or HEATER_POWER
+* @param[in] u8Size is the number of entries of the table
+* @return the index of the command, 0xFF when the table does not hold it
+* @note none
+*/
+static uint8_t a_sht40x_command_index(uint8_t u8Cmd, const uint8_t *pTable, uint8_t u8Size)
+{
+    uint8_t u8Index;
+
+    for(u8Index = 0; u8Index < u8Size; u8Index++)
+    {
+        if(pTable[u8Index] == u8Cmd)
+            return u8Index;
+    }
+
+    return 0xFF;
+}
+
+/**
+ * @brief     This function accounts a command written by a transport outside the handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u8Cmd is the command written
+ * @param[in] u8Status is the write status, 0 when the device acknowledged it
+ * @return    none
+ * @note      feeds the statistics, the trace and the log like a write of the blocking functions
+ */
+void sht40x_hook_write(sht40x_handle_t *const pHandle, uint8_t u8Cmd, uint8_t u8Status)
+{
+    uint8_t u8Index;
+
+    if(pHandle == NULL)
+        return;
+
+    a_sht40x_account_write(pHandle, u8Cmd, u8Status);
+    if(u8Status == 0)
+        return;
+
+    u8Index = a_sht40x_command_index(u8Cmd, READ_PRECISION, 3);
+    if(u8Index != 0xFF)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_MEASURE_CMD_FAILED, u8Index, "write temp and humidity cmd");
+        return;
+    }
+    u8Index = a_sht40x_command_index(u8Cmd, HEATER_POWER, 6);
+    if(u8Index != 0xFF)
+    {
+        SHT40X_EVENT(pHandle, SHT40X_LOG_HEATER_CMD_FAILED, u8Index, "write heater cmd");
+    }
+}
+
+/**
+ * @brief     This function checks a response read by a transport outside the handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u8Cmd is the command the response answers
+ * @param[in] *pFrame point to the 6 byte response
+ * @param[in] u8Status is the read status: 0 read, 4 NACKed while the device is busy, 1 failed
+ * @param[in] u32Elapsed is the time elapsed since the command was written (ms)
+ * @param[in] u8Nacked tells a read of this response was NACKed before
+ * @return  status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 a pointer is NULL
+ *            - 4 device busy, as given in u8Status
+ *            - 5 CRC mismatch in the received data
+ * @note      feeds the statistics, the trace and the log, checks the CRC and, for a measurement,
+ *            runs the alarm and learns the conversion time like sht40x_fetch_measurement
+ */
+uint8_t sht40x_hook_read(sht40x_handle_t *const pHandle, uint8_t u8Cmd, const uint8_t *pFrame, uint8_t u8Status,
+                         uint32_t u32Elapsed, uint8_t u8Nacked)
+{
+    uint8_t err;
+    uint8_t u8Precision;
+
+    if((pHandle == NULL) || (pFrame == NULL))
+        return 2;
+
+    a_sht40x_account_read(pHandle, pFrame, RESPONSE_LENGTH, (u8Status != 0) ? 1 : 0);
+    if(u8Status == SHT40X_DRV_NOT_READY)
+    {
+        SHT40X_STATS_ADD(pHandle, busy_nacks, 1);
+        SHT40X_EVENT_INFO(pHandle, SHT40X_LOG_BUSY_NACK, (uint16_t)u32Elapsed);
+        return SHT40X_DRV_NOT_READY;    /**< address NACKed, device still busy */
+    }
+
+    u8Precision = a_sht40x_command_index(u8Cmd, READ_PRECISION, 3);
+    if(u8Status != 0)
+    {
+        if(u8Precision != 0xFF)
+            SHT40X_EVENT(pHandle, SHT40X_LOG_MEASURE_READ_FAILED, u8Precision, "read temp and humidity");
+        else
+            SHT40X_EVENT(pHandle, SHT40X_LOG_HEATER_READ_FAILED, a_sht40x_command_index(u8Cmd, HEATER_POWER, 6), "read temp and humidity");
+        return 1;   /**< failed */
+    }
+
+    err = a_sht40x_check_frame(pHandle, pFrame);
+    if((err == SHT40X_DRV_OK) && (u8Precision != 0xFF))
+    {
+        a_sht40x_measured(pHandle, u8Precision, pFrame, u32Elapsed, u8Nacked);
+    }
+
+    return err;
+}
+
+
+#define SHT40X_POLL_STEP_DONE           0x00U           /**< nothing left to run */
+#define SHT40X_POLL_STEP_I2C_INIT       0x01U           /**< sht40x_init, variant and address */
+#define SHT40X_POLL_STEP_RESET          0x02U           /**< write the soft reset command */
+#define SHT40X_POLL_STEP_RESET_DONE     0x03U           /**< reset time elapsed */
+#define SHT40X_POLL_STEP_SERIAL         0x04U           /**< write the serial number command */
+#define SHT40X_POLL_STEP_SERIAL_READ    0x05U           /**< read the serial number */
+#define SHT40X_POLL_STEP_START          0x06U           /**< write the measure or heater command */
+#define SHT40X_POLL_STEP_FETCH          0x07U           /**< read the measure or heater response */
+#define SHT40X_POLL_STEP_NOW            0x80U           /**< flag, the step runs on the next call whatever the deadline */
+
+/**
+* @brief This function schedules the next step of the polled operation
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Step is the next step
+* @param[in] u32Deadline is the time at which it runs
+* @param[out] *pNext_ms point to the time to report (may be NULL)
+* @return status code
+*          - 4 operation running
+* @note none
+*/
+static uint8_t a_sht40x_poll_next(sht40x_handle_t *const pHandle, uint8_t u8Step, uint32_t u32Deadline, uint32_t *pNext_ms)
+{
+    pHandle->poll_step = u8Step;
+    pHandle->poll_deadline = u32Deadline;
+    if(pNext_ms != NULL)
+        *pNext_ms = u32Deadline;
+
+    return SHT40X_DRV_NOT_READY;
+}
+
+/**
+* @brief This function ends the polled operation
+* @param[in] *pHandle points to sht40x handle structure
+* @param[in] u8Status is the operation status
+* @param[in] u32Now_ms is the current time
+* @param[out] *pNext_ms point to the time to report (may be NULL)
+* @return the operation status
+* @note none
+*/
+static uint8_t a_sht40x_poll_finish(sht40x_handle_t *const pHandle, uint8_t u8Status, uint32_t u32Now_ms, uint32_t *pNext_ms)
+{
+    pHandle->poll_step = SHT40X_POLL_STEP_DONE;
+    pHandle->poll_status = u8Status;
+    if(pNext_ms != NULL)
+        *pNext_ms = u32Now_ms + SHT40X_POLL_NEVER;
+
+    return u8Status;
+}
+
+/**
+ * @brief     This function queues an operation for sht40x_poll
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] op is the operation to run
+ * @param[in] u8Arg is the variant for SHT40X_POLL_INIT, the precision for SHT40X_POLL_MEASURE, the heater power
+ *            for SHT40X_POLL_HEATER, ignored otherwise
+ * @return  status code
+ *            - 0 success
+ *            - 1 an operation is running, invalid operation or argument
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized, only SHT40X_POLL_INIT is accepted then
+ * @note      the bus is not touched, the first step runs on the next sht40x_poll call
+ */
+uint8_t sht40x_poll_begin(sht40x_handle_t *const pHandle, sht40x_poll_op_t op, uint8_t u8Arg)
+{
+    uint8_t u8Step;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+    if(pHandle->poll_step != SHT40X_POLL_STEP_DONE)
+        return 1;     /**< busy */
+    if((op != SHT40X_POLL_INIT) && (pHandle->inited != 1))
+        return 3;      /**< return failed error */
+
+    switch(op)
+    {
+        case SHT40X_POLL_INIT:
+            if(u8Arg > SHT45_AD1B_VARIANT)
+                return 1;
+            u8Step = SHT40X_POLL_STEP_I2C_INIT;
+            break;
+        case SHT40X_POLL_SERIAL:    u8Step = SHT40X_POLL_STEP_SERIAL; break;
+        case SHT40X_POLL_RESET:     u8Step = SHT40X_POLL_STEP_RESET; break;
+        case SHT40X_POLL_MEASURE:
+            if(u8Arg > SHT40X_PRECISION_LOWEST)
+                return 1;
+            u8Step = SHT40X_POLL_STEP_START;
+            break;
+        case SHT40X_POLL_HEATER:
+            if(u8Arg > SHT40X_HEATER_POWER_20mW_100mS)
+                return 1;
+            u8Step = SHT40X_POLL_STEP_START;
+            break;
+        default:
+            return 1;   /**< invalid operation */
+    }
+
+    pHandle->poll_op = op;
+    pHandle->poll_arg = u8Arg;
+    pHandle->poll_status = SHT40X_DRV_NOT_READY;
+    pHandle->poll_step = u8Step | SHT40X_POLL_STEP_NOW;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function advances the queued operation
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u32Now_ms is the current time in milliseconds, any monotonic source that wraps at 32 bits
+ * @param[out] *pNext_ms is the time at which to call again, u32Now_ms + SHT40X_POLL_NEVER when idle (may be NULL)
+ * @return  status code
+ *            - 0 the last operation succeeded, or nothing was ever queued
+ *            - 1 the last operation failed
+ *            - 2 pHandle is NULL
+ *            - 4 the operation is running, call again at *pNext_ms
+ *            - 5 CRC mismatch in the last operation
+ * @note      at most one i2c transfer per call. The status of a finished operation is returned
+ *            until the next sht40x_poll_begin. SHT40X_POLL_INIT leaves the handle initialized and
+ *            the serial number cached, SHT40X_POLL_HEATER calls the heater callback when linked.
+ */
+uint8_t sht40x_poll(sht40x_handle_t *const pHandle, uint32_t u32Now_ms, uint32_t *pNext_ms)
+{
+    uint8_t err;
+    uint8_t u8Wait;
+    uint32_t u32Elapsed;
+    uint8_t pStatus[RESPONSE_LENGTH];
+    sht40x_data_t data;
+
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+
+    if(pHandle->poll_step == SHT40X_POLL_STEP_DONE)
+    {
+        if(pNext_ms != NULL)
+            *pNext_ms = u32Now_ms + SHT40X_POLL_NEVER;
+        return pHandle->poll_status;    /**< idle */
+    }
+    if(((pHandle->poll_step & SHT40X_POLL_STEP_NOW) == 0) && ((int32_t)(u32Now_ms - pHandle->poll_deadline) < 0))
+    {
+        if(pNext_ms != NULL)
+            *pNext_ms = pHandle->poll_deadline;
+        return SHT40X_DRV_NOT_READY;    /**< not due yet, the bus is not touched */
+    }
+
+    switch(pHandle->poll_step & (uint8_t)~SHT40X_POLL_STEP_NOW)
+    {
+        case SHT40X_POLL_STEP_I2C_INIT:
+            err = sht40x_init(pHandle);
+            if(err == SHT40X_DRV_OK)
+                err = sht40x_set_variant(pHandle, (sht40x_variant_t)pHandle->poll_arg);
+            if(err == SHT40X_DRV_OK)
+                err = sht40x_set_addr(pHandle);         /**< address of the variant, no bus transfer */
+            if(err != SHT40X_DRV_OK)
+                return a_sht40x_poll_finish(pHandle, err, u32Now_ms, pNext_ms);
+            return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_RESET | SHT40X_POLL_STEP_NOW, u32Now_ms, pNext_ms);
+
+        case SHT40X_POLL_STEP_RESET:
+            err = a_sht40x_i2c_write(pHandle, SHT40X_SOFT_RESET_CMD, DUMMY_DATA, 0);
+            if(err != SHT40X_DRV_OK)
+            {
+                SHT40X_EVENT(pHandle, SHT40X_LOG_RESET_FAILED, 0, "to reset");
+                return a_sht40x_poll_finish(pHandle, err, u32Now_ms, pNext_ms);
+            }
+            pHandle->pending_cmd = 0;
+            SHT40X_EVENT_INFO(pHandle, SHT40X_LOG_RESET, 0);
+            return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_RESET_DONE, u32Now_ms + SOFT_RESET_DELAY, pNext_ms);
+
+        case SHT40X_POLL_STEP_RESET_DONE:
+            if(pHandle->poll_op == SHT40X_POLL_INIT)
+                return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_SERIAL | SHT40X_POLL_STEP_NOW, u32Now_ms, pNext_ms);
+            return a_sht40x_poll_finish(pHandle, 0, u32Now_ms, pNext_ms);
+
+        case SHT40X_POLL_STEP_SERIAL:
+            if(pHandle->serial_valid == 1)
+                return a_sht40x_poll_finish(pHandle, 0, u32Now_ms, pNext_ms);     /**< read once per device */
+            err = a_sht40x_i2c_write(pHandle, SHT40X_READ_SERIAL_NUMBER_CMD, DUMMY_DATA, 0);
+            if(err != SHT40X_DRV_OK)
+            {
+                SHT40X_EVENT(pHandle, SHT40X_LOG_SERIAL_CMD_FAILED, 0, "write UID cmd");
+                return a_sht40x_poll_finish(pHandle, err, u32Now_ms, pNext_ms);
+            }
+            return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_SERIAL_READ, u32Now_ms + SERIAL_NUMBER_DELAY, pNext_ms);
+
+        case SHT40X_POLL_STEP_SERIAL_READ:
+            return a_sht40x_poll_finish(pHandle, a_sht40x_read_serial(pHandle), u32Now_ms, pNext_ms);
+
+        case SHT40X_POLL_STEP_START:
+            if(pHandle->poll_op == SHT40X_POLL_MEASURE)
+            {
+                err = sht40x_start_measurement(pHandle, (sht40x_precision_t)pHandle->poll_arg);
+                if((pHandle->ready_poll == 1) && (pHandle->conversion_ms[pHandle->poll_arg] == 0))
+                    u8Wait = MEASUREMENT_POLL_DELAY;                    /**< conversion time not learned yet, start polling early */
+                else
+                    (void)sht40x_get_conversion_time(pHandle, (sht40x_precision_t)pHandle->poll_arg, &u8Wait);
+                u32Elapsed = u8Wait;
+            }
+            else
+            {
+                err = sht40x_start_heater(pHandle, (sht40x_heater_power_t)pHandle->poll_arg);
+                u32Elapsed = HEATER_DELAY[pHandle->poll_arg];
+            }
+            if(err != SHT40X_DRV_OK)
+                return a_sht40x_poll_finish(pHandle, err, u32Now_ms, pNext_ms);
+            pHandle->poll_start = u32Now_ms;
+            return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_FETCH, u32Now_ms + u32Elapsed, pNext_ms);
+
+        case SHT40X_POLL_STEP_FETCH:
+            u32Elapsed = u32Now_ms - pHandle->poll_start;
+            pHandle->pending_waited = (u32Elapsed > 0xFFFFUL) ? 0xFFFFU : (uint16_t)u32Elapsed;    /**< time base of the busy NACK window */
+            if(pHandle->poll_op == SHT40X_POLL_MEASURE)
+            {
+                err = a_sht40x_fetch_measurement(pHandle, pStatus);
+            }
+            else
+            {
+                err = sht40x_fetch_heater(pHandle, &data);
+                if(err == SHT40X_DRV_OK)
+                    memcpy(pStatus, data.rawData, RESPONSE_LENGTH);
+            }
+            if(err == SHT40X_DRV_NOT_READY)
+                return a_sht40x_poll_next(pHandle, SHT40X_POLL_STEP_FETCH, u32Now_ms + MEASUREMENT_POLL_DELAY, pNext_ms);
+            if(err == SHT40X_DRV_OK)
+            {
+                pHandle->poll_ticks.temperature = ((uint16_t)pStatus[0] << 8) | pStatus[1];
+                pHandle->poll_ticks.humidity = ((uint16_t)pStatus[3] << 8) | pStatus[4];
+            }
+            return a_sht40x_poll_finish(pHandle, err, u32Now_ms, pNext_ms);
+
+        default:
+            return a_sht40x_poll_finish(pHandle, 1, u32Now_ms, pNext_ms);     /**< corrupted state */
+    }
+}
+
+/**
+ * @brief     This function gets the raw ticks of the last measure or heater operation
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed or did not measure
+ *            - 2 pHandle is NULL
+ *            - 4 the operation is running
+ *            - 5 CRC mismatch in the last operation
+ * @note      convert with sht40x_convert_ticks or the sht40x_convert_* functions
+ */
+uint8_t sht40x_poll_get_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks)
+{
+    if((pHandle == NULL) || (pTicks == NULL))
+        return 2;     /**< return failed error */
+    if(pHandle->poll_step != SHT40X_POLL_STEP_DONE)
+        return SHT40X_DRV_NOT_READY;
+    if(pHandle->poll_status != SHT40X_DRV_OK)
+        return pHandle->poll_status;
+    if((pHandle->poll_op != SHT40X_POLL_MEASURE) && (pHandle->poll_op != SHT40X_POLL_HEATER))
+        return 1;
+
+    *pTicks = pHandle->poll_ticks;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function converts temperature ticks to milli degree Celsius
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      none
+ */
+int32_t sht40x_convert_temperature_mC(uint16_t u16Ticks)
+{
+    return SHT40X_CONVERT_T_mC(u16Ticks);
+}
+
+/**
+ * @brief     This function converts temperature ticks to milli degree Fahrenheit
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Fahrenheit
+ * @note      none
+ */
+int32_t sht40x_convert_temperature_mF(uint16_t u16Ticks)
+{
+    return SHT40X_CONVERT_T_mF(u16Ticks);
+}
+
+/**
+ * @brief     This function converts humidity ticks to milli percent relative humidity
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      none
+ */
+int32_t sht40x_convert_humidity_mRH(uint16_t u16Ticks)
+{
+    int32_t s32Humidity = SHT40X_CONVERT_RH_mRH(u16Ticks);
+
+    s32Humidity = s32Humidity > HUMIDITY_MAX_MILLI ? HUMIDITY_MAX_MILLI : s32Humidity;  /**< if humidity is high than max allowed, set to 100 % */
+    s32Humidity = s32Humidity < HUMIDITY_MIN_MILLI ? HUMIDITY_MIN_MILLI : s32Humidity;  /**< if humidity is less than min allowed, set to 0 % */
+
+    return s32Humidity;
+}
+
+/**
+ * @brief     This function fills a sensor data structure from raw ticks
+ * @param[in] u16Temperature is the raw temperature word
+ * @param[in] u16Humidity is the raw humidity word
+ * @param[out] *pData point to the sensor data to fill
+ * @return  status code
+ *            - 0 success
+ *            - 2 pData is NULL
+ * @note      rawData is rebuilt with valid CRC bytes, useful after filtering or averaging ticks
+ */
+uint8_t sht40x_convert_ticks(uint16_t u16Temperature, uint16_t u16Humidity, sht40x_data_t *pData)
+{
+    uint8_t pStatus[RESPONSE_LENGTH];
+
+    if(pData == NULL)
+        return 2;     /**< return failed error */
+
+    pStatus[0] = (uint8_t)(u16Temperature >> 8);
+    pStatus[1] = (uint8_t)u16Temperature;
+    pStatus[2] = sht40x_crc8(&pStatus[0], 2);
+    pStatus[3] = (uint8_t)(u16Humidity >> 8);
+    pStatus[4] = (uint8_t)u16Humidity;
+    pStatus[5] = sht40x_crc8(&pStatus[3], 2);
+
+    a_sht40x_convert(pStatus, pData);
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function converts an array of raw ticks
+ * @param[in] *pTicks point to the raw ticks
+ * @param[in] u32Count is the number of samples
+ * @param[out] *pTemperature_mC point to the temperatures in milli degree Celsius
+ * @param[out] *pHumidity_mRH point to the clamped relative humidities in milli percent
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      integer math, same results as the single sample converters
+ */
+uint8_t sht40x_convert_batch(const sht40x_ticks_t *pTicks, uint32_t u32Count, int32_t *pTemperature_mC, int32_t *pHumidity_mRH)
+{
+    uint32_t index;
+
+    if((pTicks == NULL) || (pTemperature_mC == NULL) || (pHumidity_mRH == NULL))
+        return 2;
+
+    for(index = 0; index < u32Count; index++)
+    {
+        pTemperature_mC[index] = sht40x_convert_temperature_mC(pTicks[index].temperature);
+        pHumidity_mRH[index] = sht40x_convert_humidity_mRH(pTicks[index].humidity);
+    }
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function get the temperature of a sample in degree Celsius
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in degree Celsius
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_temperature_C(const sht40x_data_t *const pData)
+{
+#ifdef SHT40X_FIXED_POINT
+    return (float)pData->temperature_mC / 1000.0f;
+#else
+    return pData->temperature_C;
+#endif // SHT40X_FIXED_POINT
+}
+
+/**
+ * @brief     This function get the temperature of a sample in degree Fahrenheit
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in degree Fahrenheit
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_temperature_F(const sht40x_data_t *const pData)
+{
+#ifdef SHT40X_FIXED_POINT
+    return (float)pData->temperature_mF / 1000.0f;
+#else
+    return pData->temperature_F;
+#endif // SHT40X_FIXED_POINT
+}
+
+/**
+ * @brief     This function get the relative humidity of a sample in percent
+ * @param[in] *pData point to the sensor data
+ * @return    relative humidity in percent
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_humidity(const sht40x_data_t *const pData)
+{
+#ifdef SHT40X_FIXED_POINT
+    return (float)pData->humidity_mRH / 1000.0f;
+#else
+    return pData->humidity;
+#endif // SHT40X_FIXED_POINT
+}
+
+/**
+ * @brief     This function get the temperature of a sample in milli degree Celsius
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in milli degree Celsius
+ * @note      computed from the raw data, no floating point involved
+ */
+int32_t sht40x_temperature_mC(const sht40x_data_t *const pData)
+{
+    return sht40x_convert_temperature_mC(((uint16_t)pData->rawData[0] << 8) | pData->rawData[1]);
+}
+
+/**
+ * @brief     This function get the relative humidity of a sample in milli percent
+ * @param[in] *pData point to the sensor data
+ * @return    relative humidity in milli percent
+ * @note      computed from the raw data, no floating point involved
+ */
+int32_t sht40x_humidity_mRH(const sht40x_data_t *const pData)
+{
+    return sht40x_convert_humidity_mRH(((uint16_t)pData->rawData[3] << 8) | pData->rawData[4]);
+}
+
+/**
+ * @brief     This function computes the Sensirion CRC-8 bit by bit
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      smallest footprint, suited for 8-bit cores
+ */
+uint8_t sht40x_crc8_bitwise(const uint8_t *pData, uint8_t u8Length)
+{
+    uint8_t u8Crc = SHT40X_CRC8_INIT;
+    uint8_t u8Bit;
+
+    while(u8Length--)
+    {
+        u8Crc ^= *pData++;
+        for(u8Bit = 0; u8Bit < 8; u8Bit++)
+        {
+            u8Crc = (u8Crc & 0x80) ? (uint8_t)((u8Crc << 1) ^ SHT40X_CRC8_POLYNOMIAL) : (uint8_t)(u8Crc << 1);
+        }
+    }
+
+    return u8Crc;
+}
+
+#ifdef SHT40X_CRC_TABLE
+/**
+ * @brief     This function computes the Sensirion CRC-8 with a lookup table
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      one table read per byte, costs 256 bytes of flash
+ */
+uint8_t sht40x_crc8_table(const uint8_t *pData, uint8_t u8Length)
+{
+    uint8_t u8Crc = SHT40X_CRC8_INIT;
+
+    while(u8Length--)
+    {
+        u8Crc = SHT40X_CRC8_TABLE[u8Crc ^ *pData++];
+    }
+
+    return u8Crc;
+}
+#endif // SHT40X_CRC_TABLE
+
+/**
+ * @brief     This function computes the Sensirion CRC-8 with the compile time selected variant
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      table variant when SHT40X_CRC_TABLE is defined, bitwise otherwise
+ */
+uint8_t sht40x_crc8(const uint8_t *pData, uint8_t u8Length)
+{
+#ifdef SHT40X_CRC_TABLE
+    return sht40x_crc8_table(pData, u8Length);
+#else
+    return sht40x_crc8_bitwise(pData, u8Length);
+#endif // SHT40X_CRC_TABLE
+}
+
+#ifdef SHT40X_STATS
+/**
+ * @brief     This function copies the counters of a handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] *pStats points to the snapshot to fill
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle or pStats is NULL
+ * @note      latency_min_ms is 0xFFFF until a blocking call completed
+ */
+uint8_t sht40x_get_stats(sht40x_handle_t *const pHandle, sht40x_stats_t *pStats)
+{
+    if((pHandle == NULL) || (pStats == NULL))
+        return 2;     /**< return failed error */
+
+    memcpy(pStats, &pHandle->stats, sizeof(sht40x_stats_t));
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function clears the counters of a handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ * @note      none
+ */
+uint8_t sht40x_reset_stats(sht40x_handle_t *const pHandle)
+{
+    if(pHandle == NULL)
+        return 2;     /**< return failed error */
+
+    memset(&pHandle->stats, 0, sizeof(sht40x_stats_t));
+    pHandle->stats.latency_min_ms = 0xFFFF;
+
+    return 0;   /**< success */
+}
+#endif // SHT40X_STATS
 
 /**
  * @brief      get chip's information
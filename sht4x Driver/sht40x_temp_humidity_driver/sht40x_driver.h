@@ -35,7 +35,21 @@
 #include <stdlib.h>
 #include <stdarg.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define SHT40X_DEBUG_MODE
+//#define SHT40X_FIXED_POINT                                                    /**< convert with 32-bit integer math only, results in milli-units */
+#define SHT40X_CRC_CHECK                                                        /**< verify the CRC-8 of every word read from the device */
+//#define SHT40X_CRC_TABLE                                                      /**< use the 256 byte lookup table CRC-8 instead of the bitwise one */
+//#define SHT40X_STATS                                                          /**< keep per handle transfer, error and latency counters */
+//#define SHT40X_TRACE                                                          /**< record every i2c transaction in a linked trace ring */
+//#define SHT40X_LOG                                                            /**< record driver messages as (event, argument) in a linked log ring instead of printing them */
+//#define SHT40X_ALARM                                                          /**< run a linked alarm on every measurement frame */
+//#define SHT40X_SAMPLE_DELTA                                                   /**< ring samples carry the time since the previous stored sample */
+//#define SHT40X_SAMPLE_FLAGS                                                   /**< ring samples carry first / lost / gap flags */
+//#define SHT40X_LUT_FULL                                                       /**< 64K entry conversion tables (512 KB), host builds only */
 
 /**
  * @defgroup driver_sht40x sht40x driver function
@@ -70,14 +84,45 @@
 
  #define DUMMY_DATA                                         0x00                /**< dummy data */
 
+ /* CRC-8 */
+ #define SHT40X_CRC8_POLYNOMIAL                             0x31                /**< x^8 + x^5 + x^4 + 1 */
+ #define SHT40X_CRC8_INIT                                   0xFF                /**< CRC-8 initial value */
+
  #define HUMIDITY_MIN                                       0U
  #define HUMIDITY_MAX                                       100U
+ #define HUMIDITY_MIN_MILLI                                 0L                  /**< humidity lower clamp (milli %RH) */
+ #define HUMIDITY_MAX_MILLI                                 100000L             /**< humidity upper clamp (milli %RH) */
+
+ /* Fixed point conversion, constant expressions of the raw ticks shared by the C driver, the lookup tables and the C++ binding */
+ #define SHT40X_CONVERT_T_mC(t)                             ((int32_t)(((21875UL * (uint32_t)(t)) + 4096UL) >> 13) - 45000L)   /**< 175000 / 65536 = 21875 / 8192 */
+ #define SHT40X_CONVERT_T_mF(t)                             ((int32_t)(((39375UL * (uint32_t)(t)) + 4096UL) >> 13) - 49000L)   /**< 315000 / 65536 = 39375 / 8192 */
+ #define SHT40X_CONVERT_RH_mRH(t)                           ((int32_t)(((15625UL * (uint32_t)(t)) + 4096UL) >> 13) - 6000L)    /**< 125000 / 65536 = 15625 / 8192, not clamped */
 
  /* Heater time delay */
 
 #define HEATER_DELAY_1S                                     1020U
 #define HEATER_DELAY_100mS                                  115U
 
+ /* Soft reset time delay */
+
+#define SOFT_RESET_DELAY                                    1U
+
+ /* Serial number time delay */
+
+#define SERIAL_NUMBER_DELAY                                 10U                 /**< wait between the serial number command and its read (ms) */
+
+ /* Cooperative polling */
+
+#define SHT40X_POLL_NEVER                                   0x7FFFFFFFUL        /**< deadline offset reported when idle, the farthest wrap-safe time */
+
+ /* Measurement time delay */
+
+#define MEASUREMENT_DELAY_HIGH_PREC                         9U                  /**< high precision max conversion time, 8.3 ms rounded up */
+#define MEASUREMENT_DELAY_MIDIUM_PREC                       5U                  /**< medium precision max conversion time, 4.5 ms rounded up */
+#define MEASUREMENT_DELAY_LOWEST_PREC                       2U                  /**< low precision max conversion time, 1.6 ms rounded up */
+#define MEASUREMENT_POLL_DELAY                              1U                  /**< retry interval while a measurement is not ready (ms) */
+#define MEASUREMENT_POLL_MARGIN                             3U                  /**< extra time a NACK is still read as "not ready" past the max conversion time (ms) */
+
 //static uint8_t sht40x_err;
 
 /* Read precision table */
@@ -86,6 +131,12 @@ static uint8_t  const READ_PRECISION[3] = { SHT40X_MEASURE_T_RH_HIGH_PREC_CMD,
                               SHT40X_MEASURE_T_RH_LOWEST_PREC_CMD
                             };
 
+/* Read precision conversion time table (ms), indexed like READ_PRECISION */
+static uint8_t  const MEASUREMENT_DELAY[3] = { MEASUREMENT_DELAY_HIGH_PREC,
+                              MEASUREMENT_DELAY_MIDIUM_PREC,
+                              MEASUREMENT_DELAY_LOWEST_PREC
+                            };
+
 /* Heater activate power table */
 static uint8_t const HEATER_POWER[6] = { SHT40X_ACTIVATE_HEATER_200mW_1_S_CMD,
                                          SHT40X_ACTIVATE_HEATER_200mW_100mS_CMD,
@@ -95,6 +146,15 @@ static uint8_t const HEATER_POWER[6] = { SHT40X_ACTIVATE_HEATER_200mW_1_S_CMD,
                                          SHT40X_ACTIVATE_HEATER_20mW_100mS_CMD
                                        };
 
+/* Heater pulse time table (ms), indexed like HEATER_POWER */
+static uint16_t const HEATER_DELAY[6] = { HEATER_DELAY_1S,
+                                          HEATER_DELAY_100mS,
+                                          HEATER_DELAY_1S,
+                                          HEATER_DELAY_100mS,
+                                          HEATER_DELAY_1S,
+                                          HEATER_DELAY_100mS
+                                        };
+
                            /**
 * @brief execution status enumeration
 */
@@ -103,7 +163,9 @@ typedef enum
    SHT40X_DRV_OK          = 0x00,                                     /**< status execute success */
    SHT40X_DRV_FAILED      = 0x01,                                     /**< status execute failed */
    SHT40X_DRV_ERR_HANDLER = 0x02,                                     /**< status execute failed, handle is null */
-   SHT40X_DRV_ERR_INIT    = 0x03                                      /**< status execute failed, handle not initialize */
+   SHT40X_DRV_ERR_INIT    = 0x03,                                     /**< status execute failed, handle not initialize */
+   SHT40X_DRV_NOT_READY   = 0x04,                                     /**< status execute pending, measurement not ready yet */
+   SHT40X_DRV_ERR_CRC     = 0x05                                      /**< status execute failed, received data CRC mismatch */
 } sht40x_driver_execute_stat_t;
 
  /**
@@ -157,42 +219,123 @@ typedef enum{
     SHT40X_HEATER_POWER_20mW_100mS  = 0x05                            /**< heater with 20mW for 0.1s  */
 }sht40x_heater_power_t;
 
+ /**
+ * @brief sht40x polled operation enumeration
+ */
+typedef enum{
+    SHT40X_POLL_IDLE    = 0x00,                                       /**< no operation running */
+    SHT40X_POLL_INIT    = 0x01,                                       /**< sht40x_init, variant address, soft reset, serial number read, argument is the variant */
+    SHT40X_POLL_MEASURE = 0x02,                                       /**< measurement, argument is the precision */
+    SHT40X_POLL_HEATER  = 0x03,                                       /**< heater pulse, argument is the heater power */
+    SHT40X_POLL_SERIAL  = 0x04,                                       /**< serial number read, served from the cache when valid */
+    SHT40X_POLL_RESET   = 0x05                                        /**< soft reset */
+}sht40x_poll_op_t;
+
 /**
 * @brief sht40x data structure definition
 */
  typedef struct sht40x_data_s
  {
+#ifdef SHT40X_FIXED_POINT
+    int32_t temperature_mC;                                           /**< Temperature read in milli degree Celsius    */
+    int32_t temperature_mF;                                           /**< Temperature read in milli degree Fahrenheit */
+    int32_t humidity_mRH;                                             /**< Humidity read in milli percent relative humidity */
+#else
     float temperature_C;                                              /**< Temperature read in degree Celsius    */
     float temperature_F;                                              /**< Temperature read in degree Fahrenheit */
     float humidity;                                                   /**< Humidity data read */
+#endif // SHT40X_FIXED_POINT
     uint8_t rawData[RESPONSE_LENGTH];                                 /**< Sensor raw data */
 
  }sht40x_data_t;
 
- /**
- * @brief sht40x unique ID union definition
- */
- union
+/**
+* @brief sht40x raw measurement structure definition
+*/
+typedef struct sht40x_ticks_s
+{
+    uint16_t temperature;                                             /**< raw temperature word */
+    uint16_t humidity;                                                /**< raw humidity word */
+} sht40x_ticks_t;
+
+#ifdef SHT40X_STATS
+/**
+* @brief sht40x handle counters structure definition
+* @note  latencies are in ms, measured with the linked clock or, without one, from the time waited
+*/
+typedef struct sht40x_stats_s
 {
-    uint8_t pBuffer[4];                                               /**< general purpose buffer */
-    uint32_t raw;                                                     /**< general purpose raw data */
-}static serial;
+    uint32_t cmd_measure[3];                                          /**< measurement commands per precision */
+    uint32_t cmd_heater[6];                                           /**< heater commands per power */
+    uint32_t cmd_serial;                                              /**< serial number commands */
+    uint32_t cmd_reset;                                               /**< soft reset commands */
+    uint32_t bytes_written;                                           /**< bytes written to the device */
+    uint32_t bytes_read;                                              /**< bytes read from the device */
+    uint32_t transport_errors;                                        /**< failed i2c transfers, busy NACKs included */
+    uint32_t busy_nacks;                                              /**< NACKs reported as "not ready" while polling */
+    uint32_t crc_errors;                                              /**< frames with a bad CRC */
+    uint32_t delay_ms;                                                /**< total time spent waiting */
+    uint32_t calls;                                                   /**< blocking measurement and heater calls timed */
+    uint32_t latency_total_ms;                                        /**< sum of the blocking call latencies, mean = total / calls */
+    uint16_t latency_min_ms;                                          /**< fastest blocking call */
+    uint16_t latency_max_ms;                                          /**< slowest blocking call */
+} sht40x_stats_t;
+#endif // SHT40X_STATS
 
  /**
 * @brief sht40x handle enumeration
+* @note  all driver state lives in the handle, one handle per sensor. Handles are independent
+*        and may be used from different tasks; sensors sharing a bus need the i2c functions
+*        to serialize access to that bus.
 */
 typedef struct  sht40x_handle_s
 {
-    uint8_t (*i2c_init)(void);                                                                  /**< point to a i2c init function address */
-    uint8_t (*i2c_deinit)(void);                                                                /**< point to a i2c deinit function address */
-    uint8_t (*i2c_read)(uint8_t addr, uint8_t *buf, uint8_t len);								/**< point to a i2c read function address */
-    uint8_t (*i2c_write)(uint8_t addr, uint8_t *buf, uint8_t len);								/**< point to a i2c write function address */
+    uint8_t (*i2c_init)(void *bus);                                                             /**< point to a i2c init function address */
+    uint8_t (*i2c_deinit)(void *bus);                                                           /**< point to a i2c deinit function address */
+    uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);                    /**< point to a i2c read function address */
+    uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);                   /**< point to a i2c write function address */
     void (*delay_ms)(uint32_t u32Ms);                                                           /**< point to a delay_ms function address */
     void(*debug_print)(char *fmt, ...);                                                         /**< point to a debug_print function address */
+    uint32_t (*get_tick_ms)(void);                                                              /**< point to a get_tick_ms function address (optional) */
+    void *clock;                                                                                /**< user clock context passed to the clock functions (optional) */
+    uint32_t (*clock_now_ms)(void *clock);                                                      /**< point to a monotonic clock function address, preferred over get_tick_ms (optional) */
+    void (*clock_delay_ms)(void *clock, uint32_t u32Ms);                                        /**< point to a clock delay function address, preferred over delay_ms (optional) */
+    void *i2c_bus;                                                                              /**< user bus context passed to the i2c functions */
     uint8_t i2c_address;                                                                        /**< i2c device address */
     uint8_t variant;                                                                            /**< sensor variant */
     uint8_t inited;
     sht40x_i2c_address_t addres;
+    uint8_t pending_cmd;                                                                        /**< command waiting for its response, 0 when idle */
+    uint8_t pending_index;                                                                      /**< precision or heater power of the pending command */
+    uint16_t pending_delay;                                                                     /**< max time the pending command needs (ms) */
+    uint16_t pending_nacks;                                                                     /**< busy NACKs of the pending command */
+    uint16_t pending_waited;                                                                    /**< time waited by the blocking calls since the command (ms) */
+    uint32_t pending_tick;                                                                      /**< tick at which the pending command was issued */
+    uint8_t ready_poll;                                                                         /**< read NACK means "not ready" instead of failure */
+    uint8_t conversion_ms[3];                                                                   /**< conversion time learned per precision, 0 when unknown */
+    void (*heater_callback)(struct sht40x_handle_s *pHandle, uint8_t u8Status, sht40x_data_t *pData);   /**< point to a heater completion function address (optional) */
+    uint32_t serial_number;                                                                     /**< serial number cache */
+    uint8_t serial_valid;                                                                       /**< serial_number holds the serial of the device at i2c_address */
+    uint8_t poll_op;                                                                            /**< last sht40x_poll_op_t queued */
+    uint8_t poll_step;                                                                          /**< next step of that operation */
+    uint8_t poll_arg;                                                                           /**< precision or heater power */
+    uint8_t poll_status;                                                                        /**< status of the last finished operation */
+    uint32_t poll_start;                                                                        /**< now_ms at which the command was written */
+    uint32_t poll_deadline;                                                                     /**< now_ms at which the next step runs */
+    sht40x_ticks_t poll_ticks;                                                                  /**< result of the last measure or heater operation */
+#ifdef SHT40X_STATS
+    sht40x_stats_t stats;                                                                       /**< hot path counters */
+#endif // SHT40X_STATS
+#ifdef SHT40X_TRACE
+    struct sht40x_trace_s *pTrace;                                                              /**< transaction trace ring, NULL when not recording */
+    uint8_t trace_cmd;                                                                          /**< last command written, answered by the next read */
+#endif // SHT40X_TRACE
+#ifdef SHT40X_LOG
+    struct sht40x_log_s *pLog;                                                                  /**< deferred log ring, NULL when not recording */
+#endif // SHT40X_LOG
+#ifdef SHT40X_ALARM
+    struct sht40x_alarm_s *pAlarm;                                                              /**< limits checked on every measurement, NULL when unused */
+#endif // SHT40X_ALARM
 } sht40x_handle_t;
 
 
@@ -268,6 +411,14 @@ typedef struct sht40x_info_s
  */
 #define DRIVER_SHT40X_LINK_I2C_READ(pHandle, FUC)              (pHandle)->i2c_read = FUC
 
+/**
+ * @brief     link the i2c bus context
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] BUS points to the user bus context given back to the i2c functions
+ * @note      optional, lets one set of i2c functions drive several buses
+ */
+#define DRIVER_SHT40X_LINK_I2C_BUS(pHandle, BUS)              (pHandle)->i2c_bus = BUS
+
 /**
  * @brief     link delay_ms function
  * @param[in] pHandle points to sht40x pHandle structure
@@ -284,6 +435,62 @@ typedef struct sht40x_info_s
  */
 #define DRIVER_SHT40X_LINK_DEBUG_PRINT(pHandle, FUC)          (pHandle)->debug_print = FUC
 
+/**
+ * @brief     link get_tick_ms function
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] FUC points to a get_tick_ms function address
+ * @note      optional, lets sht40x_fetch_measurement report a measurement not ready yet
+ */
+#define DRIVER_SHT40X_LINK_GET_TICK_MS(pHandle, FUC)          (pHandle)->get_tick_ms = FUC
+
+/**
+ * @brief     link a clock context with its now and delay functions
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] CLOCK points to the clock context
+ * @param[in] NOW points to a clock_now_ms function address
+ * @param[in] DELAY points to a clock_delay_ms function address
+ * @note      optional, replaces get_tick_ms and delay_ms; a virtual clock makes every wait instant
+ */
+#define DRIVER_SHT40X_LINK_CLOCK(pHandle, CLOCK, NOW, DELAY)  do { (pHandle)->clock = CLOCK; (pHandle)->clock_now_ms = NOW; (pHandle)->clock_delay_ms = DELAY; } while(0)
+
+/**
+ * @brief     link heater_callback function
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] FUC points to a heater completion function address
+ * @note      optional, called by sht40x_fetch_heater when a heater pulse completes, pData is NULL when the status is not 0
+ */
+#define DRIVER_SHT40X_LINK_HEATER_CALLBACK(pHandle, FUC)      (pHandle)->heater_callback = FUC
+
+#ifdef SHT40X_TRACE
+/**
+ * @brief     link a transaction trace ring
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] TRACE points to a sht40x_trace_t, see sht40x_driver_trace.h
+ * @note      optional, NULL stops recording
+ */
+#define DRIVER_SHT40X_LINK_TRACE(pHandle, TRACE)              (pHandle)->pTrace = TRACE
+#endif // SHT40X_TRACE
+
+#ifdef SHT40X_LOG
+/**
+ * @brief     link a deferred log ring
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] LOG points to a sht40x_log_t, see sht40x_driver_log.h
+ * @note      optional, NULL stops recording, debug_print is not needed then
+ */
+#define DRIVER_SHT40X_LINK_LOG(pHandle, LOG)                  (pHandle)->pLog = LOG
+#endif // SHT40X_LOG
+
+#ifdef SHT40X_ALARM
+/**
+ * @brief     link an alarm
+ * @param[in] pHandle points to sht40x pHandle structure
+ * @param[in] ALARM points to a sht40x_alarm_t, see sht40x_driver_alarm.h
+ * @note      optional, NULL stops checking
+ */
+#define DRIVER_SHT40X_LINK_ALARM(pHandle, ALARM)              (pHandle)->pAlarm = ALARM
+#endif // SHT40X_ALARM
+
 /**
  * @}
  */
@@ -391,10 +598,148 @@ uint8_t sht40x_get_variant(sht40x_handle_t *const pHandle, sht40x_variant_t *pVa
  *            - 1 failed to get temp/humidity
  *            - 2 pHandle is NULL
  *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
  * @note      none
  */
 uint8_t sht40x_get_temp_rh(sht40x_handle_t *const pHandle,  sht40x_precision_t precision, sht40x_data_t *pData);
 
+/**
+ * @brief     This function reads the raw temperature and humidity ticks
+ * @param[in] *pHandle points to the sht40x pHandler structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 5 CRC mismatch in the received data
+ * @note      same sequence as sht40x_get_temp_rh without any conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_read_ticks(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_ticks_t *pTicks);
+
+/**
+ * @brief     This function starts a temperature and humidity measurement without waiting for it
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to write measurement command or invalid precision
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      call sht40x_fetch_measurement once the conversion time elapsed
+ */
+uint8_t sht40x_start_measurement(sht40x_handle_t *const pHandle, sht40x_precision_t precision);
+
+/**
+ * @brief     This function fetches the result of a measurement started with sht40x_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity or no measurement started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 measurement not ready yet, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      status 4 is only reported when a clock or get_tick_ms function is linked or in ready
+ *            polling mode, otherwise the caller is responsible for waiting the conversion time
+ */
+uint8_t sht40x_fetch_measurement(sht40x_handle_t *const pHandle, sht40x_data_t *pData);
+
+/**
+ * @brief     This function fetches the raw ticks of a measurement started with sht40x_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity or no measurement started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 measurement not ready yet, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      same rules as sht40x_fetch_measurement without any conversion
+ */
+uint8_t sht40x_fetch_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks);
+
+/**
+ * @brief     This function reads the temperature and humidity of a group of sensors in one round
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      the measure command is written to every sensor back to back, the slowest
+ *            conversion time is waited once, then every sensor is read. The first linked
+ *            handle's delay function is used for the shared wait.
+ */
+uint8_t sht40x_group_get_temp_rh(sht40x_handle_t *const pHandles[], uint8_t u8Count, sht40x_precision_t precision,
+                                 sht40x_data_t *pData, uint8_t *pStatus);
+
+/**
+ * @brief     This function reads a group of sensors in one round, visiting them in a given order
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] *pOrder is a permutation of 0 .. u8Count - 1, NULL for the array order
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      with pOrder, commands are written in that order and read back in reverse, so the sensors
+ *            started last are read first. pData and pStatus stay indexed like pHandles.
+ */
+uint8_t sht40x_group_get_temp_rh_ordered(sht40x_handle_t *const pHandles[], uint8_t u8Count, const uint8_t *pOrder,
+                                         sht40x_precision_t precision, sht40x_data_t *pData, uint8_t *pStatus);
+
+/**
+ * @brief     This function enables or disables the ready polling mode
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] enable is the ready polling state
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      in ready polling mode a NACKed result read is treated as "not ready" until the
+ *            datasheet max conversion time plus MEASUREMENT_POLL_MARGIN elapsed, and the
+ *            conversion time of the device is learned from the first successful read. Without
+ *            a clock or get_tick_ms function linked, each NACK counts as MEASUREMENT_POLL_DELAY
+ *            ms: poll sht40x_fetch_measurement no more often than that.
+ */
+uint8_t sht40x_set_ready_poll(sht40x_handle_t *const pHandle, sht40x_bool_t enable);
+
+/**
+ * @brief     This function get the ready polling mode state
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pEnable point to the ready polling state
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      none
+ */
+uint8_t sht40x_get_ready_poll(sht40x_handle_t *const pHandle, sht40x_bool_t *pEnable);
+
+/**
+ * @brief     This function get the conversion time to wait for a precision
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTime_ms point to the conversion time in milliseconds
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid precision
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      returns the learned time in ready polling mode, the datasheet maximum otherwise
+ */
+uint8_t sht40x_get_conversion_time(sht40x_handle_t *const pHandle, sht40x_precision_t precision, uint8_t *pTime_ms);
+
 /**
  * @brief     This function get the device serial number
  * @param[in] *pHandle points to sht40x pHandle structure
@@ -404,7 +749,9 @@ uint8_t sht40x_get_temp_rh(sht40x_handle_t *const pHandle,  sht40x_precision_t p
  *            - 1 failed to get S/N
  *            - 2 pHandle is NULL
  *            - 3 pHandle is not initialized
- * @note      none
+ *            - 5 CRC mismatch in the received data
+ * @note      read from the device once, then served from the handle until sht40x_init or an
+ *            address change through sht40x_set_addr
  */
 uint8_t sht40x_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSerial_Number);
 
@@ -415,13 +762,48 @@ uint8_t sht40x_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSeri
  * @param[out] pData point to the sensor data to read
  * @return  status code
  *            - 0 success
- *            - 1 failed activate heater
+ *            - 1 failed activate heater or invalid power
  *            - 2 pHandle is NULL
  *            - 3 pHandle is not initialized
- * @note      Depending on heater setting selected, this routine can take up to 1000 ms delay
+ *            - 5 CRC mismatch in the received data
+ * @note      Depending on heater setting selected, this routine can take up to 1000 ms delay,
+ *            see sht40x_start_heater for the non-blocking version
  */
 uint8_t sht40x_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power, sht40x_data_t *pData);
 
+/**
+ * @brief     This function starts a heater pulse without waiting for it
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in]  power is the heater power desired
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to write heater command or invalid power
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ * @note      returns right away, the bus stays free for other devices during the pulse.
+ *            Call sht40x_fetch_heater periodically to collect the result.
+ */
+uint8_t sht40x_start_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power);
+
+/**
+ * @brief     This function collects the measurement taken at the end of a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to read or no heater pulse started
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized
+ *            - 4 heater pulse still running, call again later
+ *            - 5 CRC mismatch in the received data
+ * @note      with a clock or get_tick_ms function linked the bus is not touched before the pulse ends,
+ *            otherwise a NACKed read is reported as status 4, each one counting as
+ *            MEASUREMENT_POLL_DELAY ms, until the pulse time plus MEASUREMENT_POLL_MARGIN
+ *            elapsed. The heater callback, when
+ *            linked, is called once with the final status, and with pData only when it is 0.
+ */
+uint8_t sht40x_fetch_heater(sht40x_handle_t *const pHandle, sht40x_data_t *pData);
+
 /**
  * @brief     This function soft reset the device
  * @param[in] *pHandle points to sht40x pHandle structure
@@ -430,8 +812,276 @@ uint8_t sht40x_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_pow
  *            - 1 failed to reset
  *            - 2 pHandle is NULL
  *            - 3 pHandle is not initialized
- * @note      none
+ * @note      waits the 1 ms the device needs before it accepts a new command
  */
 uint8_t sht40x_soft_reset(sht40x_handle_t *const pHandle);
 
+/**
+ * @}
+ */
+
+/**
+* @defgroup sht40x_hook_driver sht40x transfer hook function
+* @brief    accounting of transfers a transport runs outside the handle
+* @ingroup  sht40x driver
+* @note     for drivers that own the bus themselves, such as sht40x_driver_async: each finished
+*           transfer is reported here so the statistics, the trace, the log, the alarm and the
+*           learned conversion times stay the same as with the blocking functions
+* @{
+*/
+
+/**
+ * @brief     This function accounts a command written by a transport outside the handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u8Cmd is the command written
+ * @param[in] u8Status is the write status, 0 when the device acknowledged it
+ * @return    none
+ * @note      feeds the statistics, the trace and the log like a write of the blocking functions
+ */
+void sht40x_hook_write(sht40x_handle_t *const pHandle, uint8_t u8Cmd, uint8_t u8Status);
+
+/**
+ * @brief     This function checks a response read by a transport outside the handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u8Cmd is the command the response answers
+ * @param[in] *pFrame point to the 6 byte response
+ * @param[in] u8Status is the read status: 0 read, 4 NACKed while the device is busy, 1 failed
+ * @param[in] u32Elapsed is the time elapsed since the command was written (ms)
+ * @param[in] u8Nacked tells a read of this response was NACKed before
+ * @return  status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 a pointer is NULL
+ *            - 4 device busy, as given in u8Status
+ *            - 5 CRC mismatch in the received data
+ * @note      feeds the statistics, the trace and the log, checks the CRC and, for a measurement,
+ *            runs the alarm and learns the conversion time like sht40x_fetch_measurement
+ */
+uint8_t sht40x_hook_read(sht40x_handle_t *const pHandle, uint8_t u8Cmd, const uint8_t *pFrame, uint8_t u8Status,
+                         uint32_t u32Elapsed, uint8_t u8Nacked);
+
+/**
+ * @}
+ */
+
+/**
+* @defgroup sht40x_poll_driver sht40x cooperative polling function
+* @brief    every operation as a resumable state machine for superloops without RTOS
+* @ingroup  sht40x driver
+* @note     sht40x_poll_begin only records the operation, each sht40x_poll call then runs at
+*           most one i2c transfer and tells when it wants to be called again. No delay function
+*           is ever called, the main loop may sleep until the earliest deadline of its handles.
+* @{
+*/
+
+/**
+ * @brief     This function queues an operation for sht40x_poll
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] op is the operation to run
+ * @param[in] u8Arg is the variant for SHT40X_POLL_INIT, the precision for SHT40X_POLL_MEASURE, the heater power
+ *            for SHT40X_POLL_HEATER, ignored otherwise
+ * @return  status code
+ *            - 0 success
+ *            - 1 an operation is running, invalid operation or argument
+ *            - 2 pHandle is NULL
+ *            - 3 pHandle is not initialized, only SHT40X_POLL_INIT is accepted then
+ * @note      the bus is not touched, the first step runs on the next sht40x_poll call
+ */
+uint8_t sht40x_poll_begin(sht40x_handle_t *const pHandle, sht40x_poll_op_t op, uint8_t u8Arg);
+
+/**
+ * @brief     This function advances the queued operation
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] u32Now_ms is the current time in milliseconds, any monotonic source that wraps at 32 bits
+ * @param[out] *pNext_ms is the time at which to call again, u32Now_ms + SHT40X_POLL_NEVER when idle (may be NULL)
+ * @return  status code
+ *            - 0 the last operation succeeded, or nothing was ever queued
+ *            - 1 the last operation failed
+ *            - 2 pHandle is NULL
+ *            - 4 the operation is running, call again at *pNext_ms
+ *            - 5 CRC mismatch in the last operation
+ * @note      at most one i2c transfer per call. The status of a finished operation is returned
+ *            until the next sht40x_poll_begin. SHT40X_POLL_INIT leaves the handle initialized and
+ *            the serial number cached, SHT40X_POLL_HEATER calls the heater callback when linked.
+ */
+uint8_t sht40x_poll(sht40x_handle_t *const pHandle, uint32_t u32Now_ms, uint32_t *pNext_ms);
+
+/**
+ * @brief     This function gets the raw ticks of the last measure or heater operation
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed or did not measure
+ *            - 2 pHandle is NULL
+ *            - 4 the operation is running
+ *            - 5 CRC mismatch in the last operation
+ * @note      convert with sht40x_convert_ticks or the sht40x_convert_* functions
+ */
+uint8_t sht40x_poll_get_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks);
+
+/**
+ * @}
+ */
+
+/**
+* @defgroup sht40x_convert_driver sht40x conversion function
+* @brief    sht40x raw ticks conversion modules
+* @ingroup  sht40x driver
+* @note     The integer conversions use only 32-bit multiply and shift. The datasheet scale
+*           factor x / 65535 is replaced by x / 65536 (factor / 8192 after reduction) and the
+*           result is rounded half up (SHT40X_CONVERT_T_mC, SHT40X_CONVERT_T_mF, SHT40X_CONVERT_RH_mRH):
+*             - milli C  = ((21875 * ticks + 4096) >> 13) - 45000
+*             - milli F  = ((39375 * ticks + 4096) >> 13) - 49000
+*             - milli RH = ((15625 * ticks + 4096) >> 13) - 6000, clamped to 0 .. 100000
+*           Over the full tick range the results stay within 4 m°C, 6 m°F and 3 m%RH of the
+*           floating point formula and are bit-exact across compilers and targets.
+* @{
+*/
+
+/**
+ * @brief     This function converts temperature ticks to milli degree Celsius
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      none
+ */
+int32_t sht40x_convert_temperature_mC(uint16_t u16Ticks);
+
+/**
+ * @brief     This function converts temperature ticks to milli degree Fahrenheit
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Fahrenheit
+ * @note      none
+ */
+int32_t sht40x_convert_temperature_mF(uint16_t u16Ticks);
+
+/**
+ * @brief     This function converts humidity ticks to milli percent relative humidity
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      none
+ */
+int32_t sht40x_convert_humidity_mRH(uint16_t u16Ticks);
+
+/**
+ * @brief     This function fills a sensor data structure from raw ticks
+ * @param[in] u16Temperature is the raw temperature word
+ * @param[in] u16Humidity is the raw humidity word
+ * @param[out] *pData point to the sensor data to fill
+ * @return  status code
+ *            - 0 success
+ *            - 2 pData is NULL
+ * @note      rawData is rebuilt with valid CRC bytes, useful after filtering or averaging ticks
+ */
+uint8_t sht40x_convert_ticks(uint16_t u16Temperature, uint16_t u16Humidity, sht40x_data_t *pData);
+
+/**
+ * @brief     This function converts an array of raw ticks
+ * @param[in] *pTicks point to the raw ticks
+ * @param[in] u32Count is the number of samples
+ * @param[out] *pTemperature_mC point to the temperatures in milli degree Celsius
+ * @param[out] *pHumidity_mRH point to the clamped relative humidities in milli percent
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      integer math, same results as the single sample converters
+ */
+uint8_t sht40x_convert_batch(const sht40x_ticks_t *pTicks, uint32_t u32Count, int32_t *pTemperature_mC, int32_t *pHumidity_mRH);
+
+/**
+ * @brief     This function get the temperature of a sample in degree Celsius
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in degree Celsius
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_temperature_C(const sht40x_data_t *const pData);
+
+/**
+ * @brief     This function get the temperature of a sample in degree Fahrenheit
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in degree Fahrenheit
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_temperature_F(const sht40x_data_t *const pData);
+
+/**
+ * @brief     This function get the relative humidity of a sample in percent
+ * @param[in] *pData point to the sensor data
+ * @return    relative humidity in percent
+ * @note      available in both fixed point and floating point builds
+ */
+float sht40x_humidity(const sht40x_data_t *const pData);
+
+/**
+ * @brief     This function get the temperature of a sample in milli degree Celsius
+ * @param[in] *pData point to the sensor data
+ * @return    temperature in milli degree Celsius
+ * @note      computed from the raw data, no floating point involved
+ */
+int32_t sht40x_temperature_mC(const sht40x_data_t *const pData);
+
+/**
+ * @brief     This function get the relative humidity of a sample in milli percent
+ * @param[in] *pData point to the sensor data
+ * @return    relative humidity in milli percent
+ * @note      computed from the raw data, no floating point involved
+ */
+int32_t sht40x_humidity_mRH(const sht40x_data_t *const pData);
+
+/**
+ * @brief     This function computes the Sensirion CRC-8 bit by bit
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      smallest footprint, suited for 8-bit cores
+ */
+uint8_t sht40x_crc8_bitwise(const uint8_t *pData, uint8_t u8Length);
+
+#ifdef SHT40X_CRC_TABLE
+/**
+ * @brief     This function computes the Sensirion CRC-8 with a lookup table
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      one table read per byte, costs 256 bytes of flash
+ */
+uint8_t sht40x_crc8_table(const uint8_t *pData, uint8_t u8Length);
+#endif // SHT40X_CRC_TABLE
+
+/**
+ * @brief     This function computes the Sensirion CRC-8 with the compile time selected variant
+ * @param[in] *pData point to the data to checksum
+ * @param[in] u8Length is the number of bytes
+ * @return    CRC-8 (polynomial 0x31, init 0xFF)
+ * @note      table variant when SHT40X_CRC_TABLE is defined, bitwise otherwise
+ */
+uint8_t sht40x_crc8(const uint8_t *pData, uint8_t u8Length);
+
+#ifdef SHT40X_STATS
+/**
+ * @brief     This function copies the counters of a handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] *pStats points to the snapshot to fill
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle or pStats is NULL
+ * @note      latency_min_ms is 0xFFFF until a blocking call completed
+ */
+uint8_t sht40x_get_stats(sht40x_handle_t *const pHandle, sht40x_stats_t *pStats);
+
+/**
+ * @brief     This function clears the counters of a handle
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pHandle is NULL
+ * @note      none
+ */
+uint8_t sht40x_reset_stats(sht40x_handle_t *const pHandle);
+#endif // SHT40X_STATS
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // SHT40X_DRIVER_H_INCLUDED
@@ -0,0 +1,315 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver.hpp
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 05:45 PM
+ */
+
+#ifndef SHT40X_DRIVER_HPP_INCLUDED
+#define SHT40X_DRIVER_HPP_INCLUDED
+
+#include <stdint.h>
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_cpp_driver sht40x C++ driver
+ * @brief    header only C++17 binding, transport and clock are static policies resolved at compile time
+ * @ingroup  sht40x driver
+ * @{
+ *
+ * A Transport policy provides
+ *     static uint8_t write(uint8_t addr, const uint8_t *pBuf, uint8_t u8Length);   // 0 on success
+ *     static uint8_t read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length);          // 0 on success
+ * A Clock policy provides
+ *     static void delay_ms(uint32_t u32Ms);
+ *
+ * Commands, addresses and delays come from sht40x_driver.h, the C API keeps working side by side.
+ */
+
+namespace sht4x
+{
+
+/**
+ * @brief status codes, same values as sht40x_driver_execute_stat_t
+ */
+enum class Status : uint8_t
+{
+    Ok       = SHT40X_DRV_OK,                                         /**< success */
+    Failed   = SHT40X_DRV_FAILED,                                     /**< transfer failed */
+    NotReady = SHT40X_DRV_NOT_READY,                                  /**< measurement not ready yet */
+    Crc      = SHT40X_DRV_ERR_CRC                                     /**< received data CRC mismatch */
+};
+
+/**
+ * @brief measurement precision, same values as sht40x_precision_t
+ */
+enum class Precision : uint8_t
+{
+    High   = SHT40X_PRECISION_HIGH,                                   /**< high repeatability */
+    Medium = SHT40X_PRECISION_MIDIUM,                                 /**< medium repeatability */
+    Lowest = SHT40X_PRECISION_LOWEST                                  /**< low repeatability */
+};
+
+/**
+ * @brief heater setting, same values as sht40x_heater_power_t
+ */
+enum class Heater : uint8_t
+{
+    P200mW_1s    = SHT40X_HEATER_POWER_200mW_1S,                      /**< 200mW for 1s */
+    P200mW_100ms = SHT40X_HEATER_POWER_200mW_100mS,                   /**< 200mW for 0.1s */
+    P110mW_1s    = SHT40X_HEATER_POWER_110mW_1S,                      /**< 110mW for 1s */
+    P110mW_100ms = SHT40X_HEATER_POWER_110mW_100mS,                   /**< 110mW for 0.1s */
+    P20mW_1s     = SHT40X_HEATER_POWER_20mW_1S,                       /**< 20mW for 1s */
+    P20mW_100ms  = SHT40X_HEATER_POWER_20mW_100mS                     /**< 20mW for 0.1s */
+};
+
+/**
+ * @brief i2c address of a variant
+ */
+constexpr uint8_t address(sht40x_variant_t variant)
+{
+    return (variant == SHT40_BD1B_VARIANT) ? static_cast<uint8_t>(SHT40_BD1B_IIC_ADDRESS)
+                                           : static_cast<uint8_t>(SHT40_AD1B_IIC_ADDRESS);
+}
+
+/**
+ * @brief measurement command of a precision
+ */
+constexpr uint8_t command(Precision precision)
+{
+    return (precision == Precision::High)   ? SHT40X_MEASURE_T_RH_HIGH_PREC_CMD :
+           (precision == Precision::Medium) ? SHT40X_MEASURE_T_RH_MIDIUM_PREC_CMD :
+                                              SHT40X_MEASURE_T_RH_LOWEST_PREC_CMD;
+}
+
+/**
+ * @brief heater command of a heater setting
+ */
+constexpr uint8_t command(Heater heater)
+{
+    constexpr uint8_t kCommand[6] = { SHT40X_ACTIVATE_HEATER_200mW_1_S_CMD, SHT40X_ACTIVATE_HEATER_200mW_100mS_CMD,
+                                      SHT40X_ACTIVATE_HEATER_110mW_1_S_CMD, SHT40X_ACTIVATE_HEATER_110mW_100mS_CMD,
+                                      SHT40X_ACTIVATE_HEATER_20mW_1_S_CMD,  SHT40X_ACTIVATE_HEATER_20mW_100mS_CMD };
+    return kCommand[static_cast<uint8_t>(heater)];
+}
+
+/**
+ * @brief worst case conversion time of a precision (ms)
+ */
+constexpr uint8_t delay_ms(Precision precision)
+{
+    return (precision == Precision::High)   ? MEASUREMENT_DELAY_HIGH_PREC :
+           (precision == Precision::Medium) ? MEASUREMENT_DELAY_MIDIUM_PREC :
+                                              MEASUREMENT_DELAY_LOWEST_PREC;
+}
+
+/**
+ * @brief worst case pulse time of a heater setting, measurement included (ms)
+ * @note  read from HEATER_DELAY like the C driver, not constexpr as that table is a plain C const array
+ */
+inline uint16_t delay_ms(Heater heater)
+{
+    return HEATER_DELAY[static_cast<uint8_t>(heater)];
+}
+
+/**
+ * @brief Sensirion CRC-8 (polynomial 0x31, init 0xFF) of one word
+ */
+constexpr uint8_t crc8(uint8_t u8High, uint8_t u8Low)
+{
+    uint8_t u8Crc = SHT40X_CRC8_INIT;
+    const uint8_t pData[2] = { u8High, u8Low };
+
+    for(uint8_t index = 0; index < 2; index++)
+    {
+        u8Crc ^= pData[index];
+        for(uint8_t bit = 0; bit < 8; bit++)
+        {
+            u8Crc = (u8Crc & 0x80U) ? static_cast<uint8_t>((u8Crc << 1) ^ SHT40X_CRC8_POLYNOMIAL) : static_cast<uint8_t>(u8Crc << 1);
+        }
+    }
+    return u8Crc;
+}
+
+static_assert(crc8(0xBE, 0xEF) == 0x92, "datasheet CRC example");
+
+/**
+ * @brief one measurement as raw ticks, converted on demand with the integer formulas of the C driver
+ */
+struct Measurement
+{
+    uint16_t temperature;                                             /**< raw temperature ticks */
+    uint16_t humidity;                                                /**< raw humidity ticks */
+
+    /** temperature in milli degree Celsius */
+    constexpr int32_t temperature_mC() const
+    {
+        return SHT40X_CONVERT_T_mC(temperature);
+    }
+
+    /** temperature in milli degree Fahrenheit */
+    constexpr int32_t temperature_mF() const
+    {
+        return SHT40X_CONVERT_T_mF(temperature);
+    }
+
+    /** humidity in milli %RH, clamped to 0 .. 100 %RH */
+    constexpr int32_t humidity_mRH() const
+    {
+        int32_t i32Humidity = SHT40X_CONVERT_RH_mRH(humidity);
+
+        return (i32Humidity < HUMIDITY_MIN_MILLI) ? HUMIDITY_MIN_MILLI :
+               (i32Humidity > HUMIDITY_MAX_MILLI) ? HUMIDITY_MAX_MILLI : i32Humidity;
+    }
+
+    /** temperature in degree Celsius */
+    constexpr float temperature_C() const { return static_cast<float>(temperature_mC()) / 1000.0f; }
+
+    /** temperature in degree Fahrenheit */
+    constexpr float temperature_F() const { return static_cast<float>(temperature_mF()) / 1000.0f; }
+
+    /** humidity in %RH */
+    constexpr float humidity_RH() const { return static_cast<float>(humidity_mRH()) / 1000.0f; }
+};
+
+/**
+ * @brief SHT4x sensor bound at compile time to a transport, a clock and a variant
+ * @note  no state, no function pointer, no NULL or init check: every call inlines to the transfers
+ */
+template <class Transport, class Clock, sht40x_variant_t Variant, bool CheckCrc = true>
+class Sensor
+{
+public:
+    static constexpr uint8_t kAddress = address(Variant);            /**< i2c address of the variant */
+
+    /**
+     * @brief     start a measurement
+     * @return    Status::Ok or Status::Failed
+     */
+    template <Precision P>
+    static Status start()
+    {
+        return write_command(command(P));
+    }
+
+    /**
+     * @brief     read the result of a measurement or heater pulse
+     * @param[out] out receives the raw ticks
+     * @return    Status::Ok, Status::Failed (or not ready, the device NACKs while busy) or Status::Crc
+     */
+    static Status fetch(Measurement &out)
+    {
+        uint8_t pFrame[RESPONSE_LENGTH];
+
+        if(Transport::read(kAddress, pFrame, RESPONSE_LENGTH) != 0)
+            return Status::Failed;
+        if(CheckCrc && ((crc8(pFrame[0], pFrame[1]) != pFrame[2]) || (crc8(pFrame[3], pFrame[4]) != pFrame[5])))
+            return Status::Crc;
+
+        out.temperature = static_cast<uint16_t>((pFrame[0] << 8) | pFrame[1]);
+        out.humidity = static_cast<uint16_t>((pFrame[3] << 8) | pFrame[4]);
+        return Status::Ok;
+    }
+
+    /**
+     * @brief     blocking measurement, same sequence as sht40x_get_temp_rh
+     * @param[out] out receives the raw ticks
+     * @return    status
+     */
+    template <Precision P = Precision::High>
+    static Status measure(Measurement &out)
+    {
+        Status status = start<P>();
+
+        if(status != Status::Ok)
+            return status;
+        Clock::delay_ms(delay_ms(P));
+        return fetch(out);
+    }
+
+    /**
+     * @brief     blocking heater pulse and measurement, same sequence as sht40x_activate_heater
+     * @param[out] out receives the raw ticks measured at the end of the pulse
+     * @return    status
+     */
+    template <Heater H>
+    static Status heat(Measurement &out)
+    {
+        Status status = write_command(command(H));
+
+        if(status != Status::Ok)
+            return status;
+        Clock::delay_ms(delay_ms(H));
+        return fetch(out);
+    }
+
+    /**
+     * @brief     read the serial number
+     * @param[out] serial receives (word 0 << 16) | word 1
+     * @return    status
+     */
+    static Status serial_number(uint32_t &serial)
+    {
+        uint8_t pFrame[RESPONSE_LENGTH];
+        Status status = write_command(SHT40X_READ_SERIAL_NUMBER_CMD);
+
+        if(status != Status::Ok)
+            return status;
+        Clock::delay_ms(SERIAL_NUMBER_DELAY);
+        if(Transport::read(kAddress, pFrame, RESPONSE_LENGTH) != 0)
+            return Status::Failed;
+        if(CheckCrc && ((crc8(pFrame[0], pFrame[1]) != pFrame[2]) || (crc8(pFrame[3], pFrame[4]) != pFrame[5])))
+            return Status::Crc;
+
+        serial = (static_cast<uint32_t>(pFrame[0]) << 24) | (static_cast<uint32_t>(pFrame[1]) << 16) |
+                 (static_cast<uint32_t>(pFrame[3]) << 8) | pFrame[4];
+        return Status::Ok;
+    }
+
+    /**
+     * @brief     soft reset, waits until the device accepts commands again
+     * @return    status
+     */
+    static Status soft_reset()
+    {
+        Status status = write_command(SHT40X_SOFT_RESET_CMD);
+
+        if(status == Status::Ok)
+            Clock::delay_ms(SOFT_RESET_DELAY);
+        return status;
+    }
+
+private:
+    static Status write_command(uint8_t u8Cmd)
+    {
+        return (Transport::write(kAddress, &u8Cmd, 1) == 0) ? Status::Ok : Status::Failed;
+    }
+};
+
+} // namespace sht4x
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_HPP_INCLUDED
@@ -0,0 +1,245 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_alarm.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 07:05 PM
+ */
+
+#include "sht40x_driver_alarm.h"
+
+/**
+* @brief This function converts ticks with the converter of a channel
+* @param[in] u8Channel is the channel
+* @param[in] u32Ticks is the raw word
+* @return value in milli-units
+* @note none
+*/
+static int32_t a_sht40x_alarm_convert(uint8_t u8Channel, uint32_t u32Ticks)
+{
+    if(u8Channel == SHT40X_ALARM_TEMPERATURE)
+        return sht40x_convert_temperature_mC((uint16_t)u32Ticks);
+    return sht40x_convert_humidity_mRH((uint16_t)u32Ticks);
+}
+
+/**
+* @brief This function adds two values, saturating to the int32_t range
+* @param[in] s32Value is the value
+* @param[in] s32Offset is the offset to add
+* @return saturated sum
+* @note none
+*/
+static int32_t a_sht40x_alarm_add(int32_t s32Value, int32_t s32Offset)
+{
+    int64_t s64Sum = (int64_t)s32Value + s32Offset;
+
+    if(s64Sum > INT32_MAX)
+        return INT32_MAX;
+    if(s64Sum < INT32_MIN)
+        return INT32_MIN;
+    return (int32_t)s64Sum;
+}
+
+/**
+* @brief This function finds the smallest tick converting to at least a value
+* @param[in] u8Channel is the channel
+* @param[in] s32Value is the value in milli-units
+* @return tick, 65536 when no tick reaches the value
+* @note binary search, the converters never decrease
+*/
+static uint32_t a_sht40x_alarm_ceil(uint8_t u8Channel, int32_t s32Value)
+{
+    uint32_t u32Low = 0;
+    uint32_t u32High = 65536UL;
+
+    while(u32Low < u32High)
+    {
+        uint32_t u32Mid = (u32Low + u32High) >> 1;
+
+        if(a_sht40x_alarm_convert(u8Channel, u32Mid) >= s32Value)
+            u32High = u32Mid;
+        else
+            u32Low = u32Mid + 1;
+    }
+    return u32Low;
+}
+
+/**
+* @brief This function steps the state machine of a channel
+* @param[in] *pAlarm points to the alarm structure
+* @param[in] u8Channel is the channel
+* @param[in] u16Ticks is the raw word
+* @return none
+* @note none
+*/
+static void a_sht40x_alarm_step(sht40x_alarm_t *const pAlarm, uint8_t u8Channel, uint16_t u16Ticks)
+{
+    sht40x_alarm_limit_t *pLimit = &pAlarm->channel[u8Channel];
+    uint8_t u8Target = SHT40X_ALARM_NORMAL;
+
+    if((pLimit->flags & SHT40X_ALARM_HIGH_ENABLED) &&
+       ((u16Ticks >= pLimit->high_set) || ((pLimit->state == SHT40X_ALARM_HIGH) && (u16Ticks >= pLimit->high_clear))))
+        u8Target = SHT40X_ALARM_HIGH;
+    else if((pLimit->flags & SHT40X_ALARM_LOW_ENABLED) &&
+            ((u16Ticks <= pLimit->low_set) || ((pLimit->state == SHT40X_ALARM_LOW) && (u16Ticks <= pLimit->low_clear))))
+        u8Target = SHT40X_ALARM_LOW;
+
+    if(u8Target == pLimit->state)
+    {
+        pLimit->count = 0;          /**< back to the reported state, drop a half counted change */
+        return;
+    }
+    if(u8Target != pLimit->pending)
+    {
+        pLimit->pending = u8Target;
+        pLimit->count = 0;
+    }
+    if(++pLimit->count < pAlarm->debounce)
+        return;
+
+    pLimit->state = u8Target;
+    pLimit->count = 0;
+    if(pAlarm->callback != NULL)
+        pAlarm->callback(pAlarm, u8Channel, u8Target, u16Ticks);
+}
+
+/**
+ * @brief     This function initializes an alarm with every limit disabled
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] u8Debounce is the number of consecutive samples needed to change state, 0 is taken as 1
+ * @param[in] callback is called on every state change, may be NULL
+ * @param[in] *pContext is kept for the callback
+ * @return  status code
+ *            - 0 success
+ *            - 2 pAlarm is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_ALARM (SHT40X_ALARM) or feed it with sht40x_alarm_process
+ */
+uint8_t sht40x_alarm_init(sht40x_alarm_t *const pAlarm, uint8_t u8Debounce,
+                          void (*callback)(sht40x_alarm_t *pAlarm, uint8_t u8Channel, uint8_t u8State, uint16_t u16Ticks), void *pContext)
+{
+    if(pAlarm == NULL)
+        return 2;
+
+    memset(pAlarm, 0, sizeof(sht40x_alarm_t));
+    pAlarm->debounce = (u8Debounce == 0) ? 1 : u8Debounce;
+    pAlarm->callback = callback;
+    pAlarm->pContext = pContext;
+
+    return 0;
+}
+
+/**
+ * @brief     This function sets the limits of a channel
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] channel is the channel to set
+ * @param[in] s32Low is the low limit in milli-units, SHT40X_ALARM_NO_LOW to disable
+ * @param[in] s32High is the high limit in milli-units, SHT40X_ALARM_NO_HIGH to disable
+ * @param[in] s32Hysteresis is how far back inside the limits a value must come to clear the alarm, in milli-units
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid channel, low above high or negative hysteresis
+ *            - 2 pAlarm is NULL
+ * @note      the limits are turned into ticks here once, a limit the sensor cannot reach is disabled.
+ *            The channel returns to NORMAL without a callback.
+ */
+uint8_t sht40x_alarm_set_limits(sht40x_alarm_t *const pAlarm, sht40x_alarm_channel_t channel,
+                                int32_t s32Low, int32_t s32High, int32_t s32Hysteresis)
+{
+    sht40x_alarm_limit_t *pLimit;
+    uint32_t u32Tick;
+
+    if(pAlarm == NULL)
+        return 2;
+    if((channel > SHT40X_ALARM_HUMIDITY) || (s32Low > s32High) || (s32Hysteresis < 0))
+        return 1;
+
+    pLimit = &pAlarm->channel[channel];
+    memset(pLimit, 0, sizeof(sht40x_alarm_limit_t));
+
+    if(s32High != SHT40X_ALARM_NO_HIGH)
+    {
+        u32Tick = a_sht40x_alarm_ceil(channel, s32High);
+        if(u32Tick <= 0xFFFFUL)
+        {
+            pLimit->high_set = (uint16_t)u32Tick;
+            pLimit->high_clear = (uint16_t)a_sht40x_alarm_ceil(channel, a_sht40x_alarm_add(s32High, -s32Hysteresis));   /**< below it the value is under high - hysteresis */
+            pLimit->flags |= SHT40X_ALARM_HIGH_ENABLED;
+        }
+    }
+
+    if(s32Low != SHT40X_ALARM_NO_LOW)
+    {
+        u32Tick = a_sht40x_alarm_ceil(channel, a_sht40x_alarm_add(s32Low, 1));        /**< first tick above the limit */
+        if(u32Tick > 0)
+        {
+            pLimit->low_set = (uint16_t)(u32Tick - 1);
+            u32Tick = a_sht40x_alarm_ceil(channel, a_sht40x_alarm_add(a_sht40x_alarm_add(s32Low, s32Hysteresis), 1));
+            pLimit->low_clear = (uint16_t)(u32Tick - 1);          /**< above it the value is over low + hysteresis */
+            pLimit->flags |= SHT40X_ALARM_LOW_ENABLED;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     This function runs one sample through both channels
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] *pTicks points to the raw sample
+ * @return  status code
+ *            - 0 success
+ *            - 2 pAlarm or pTicks is NULL
+ * @note      integer compares only, the callback runs from here
+ */
+uint8_t sht40x_alarm_process(sht40x_alarm_t *const pAlarm, const sht40x_ticks_t *pTicks)
+{
+    if((pAlarm == NULL) || (pTicks == NULL))
+        return 2;
+
+    a_sht40x_alarm_step(pAlarm, SHT40X_ALARM_TEMPERATURE, pTicks->temperature);
+    a_sht40x_alarm_step(pAlarm, SHT40X_ALARM_HUMIDITY, pTicks->humidity);
+
+    return 0;
+}
+
+/**
+ * @brief     This function gets the state of a channel
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] channel is the channel to read
+ * @param[out] *pState points to the state
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid channel
+ *            - 2 pAlarm or pState is NULL
+ * @note      none
+ */
+uint8_t sht40x_alarm_get_state(const sht40x_alarm_t *const pAlarm, sht40x_alarm_channel_t channel, sht40x_alarm_state_t *pState)
+{
+    if((pAlarm == NULL) || (pState == NULL))
+        return 2;
+    if(channel > SHT40X_ALARM_HUMIDITY)
+        return 1;
+
+    *pState = (sht40x_alarm_state_t)pAlarm->channel[channel].state;
+
+    return 0;
+}
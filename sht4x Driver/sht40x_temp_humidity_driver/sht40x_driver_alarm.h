@@ -0,0 +1,150 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_alarm.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 07:05 PM
+ */
+
+#ifndef SHT40X_DRIVER_ALARM_H_INCLUDED
+#define SHT40X_DRIVER_ALARM_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_alarm_driver sht40x alarm function
+ * @brief    temperature and humidity limits checked on raw ticks, with hysteresis and debounce
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_ALARM_NO_LOW             INT32_MIN       /**< low limit disabled */
+#define SHT40X_ALARM_NO_HIGH            INT32_MAX       /**< high limit disabled */
+#define SHT40X_ALARM_LOW_ENABLED        0x01U           /**< limit flags, low limit reachable */
+#define SHT40X_ALARM_HIGH_ENABLED       0x02U           /**< limit flags, high limit reachable */
+
+ /**
+ * @brief sht40x alarm channel enumeration
+ */
+typedef enum
+{
+    SHT40X_ALARM_TEMPERATURE = 0x00,                                  /**< limits in milli degree Celsius */
+    SHT40X_ALARM_HUMIDITY    = 0x01                                   /**< limits in milli percent relative humidity */
+} sht40x_alarm_channel_t;
+
+ /**
+ * @brief sht40x alarm state enumeration
+ */
+typedef enum
+{
+    SHT40X_ALARM_NORMAL = 0x00,                                       /**< between the limits */
+    SHT40X_ALARM_LOW    = 0x01,                                       /**< at or below the low limit */
+    SHT40X_ALARM_HIGH   = 0x02                                        /**< at or above the high limit */
+} sht40x_alarm_state_t;
+
+/**
+* @brief sht40x alarm channel limits structure definition
+* @note  every threshold is in raw ticks, no conversion runs per sample
+*/
+typedef struct sht40x_alarm_limit_s
+{
+    uint16_t low_set;                                                 /**< enter LOW at or below this tick */
+    uint16_t low_clear;                                               /**< leave LOW above this tick */
+    uint16_t high_set;                                                /**< enter HIGH at or above this tick */
+    uint16_t high_clear;                                              /**< leave HIGH below this tick */
+    uint8_t flags;                                                    /**< SHT40X_ALARM_LOW_ENABLED | SHT40X_ALARM_HIGH_ENABLED */
+    uint8_t state;                                                    /**< sht40x_alarm_state_t reported */
+    uint8_t pending;                                                  /**< state the last samples point to */
+    uint8_t count;                                                    /**< consecutive samples pointing to pending */
+} sht40x_alarm_limit_t;
+
+/**
+* @brief sht40x alarm structure definition
+*/
+typedef struct sht40x_alarm_s
+{
+    sht40x_alarm_limit_t channel[2];                                  /**< indexed by sht40x_alarm_channel_t */
+    uint8_t debounce;                                                 /**< consecutive samples needed to change state */
+    void (*callback)(struct sht40x_alarm_s *pAlarm, uint8_t u8Channel, uint8_t u8State, uint16_t u16Ticks);   /**< state change function (optional) */
+    void *pContext;                                                   /**< caller data for the callback */
+} sht40x_alarm_t;
+
+/**
+ * @brief     This function initializes an alarm with every limit disabled
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] u8Debounce is the number of consecutive samples needed to change state, 0 is taken as 1
+ * @param[in] callback is called on every state change, may be NULL
+ * @param[in] *pContext is kept for the callback
+ * @return  status code
+ *            - 0 success
+ *            - 2 pAlarm is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_ALARM (SHT40X_ALARM) or feed it with sht40x_alarm_process
+ */
+uint8_t sht40x_alarm_init(sht40x_alarm_t *const pAlarm, uint8_t u8Debounce,
+                          void (*callback)(sht40x_alarm_t *pAlarm, uint8_t u8Channel, uint8_t u8State, uint16_t u16Ticks), void *pContext);
+
+/**
+ * @brief     This function sets the limits of a channel
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] channel is the channel to set
+ * @param[in] s32Low is the low limit in milli-units, SHT40X_ALARM_NO_LOW to disable
+ * @param[in] s32High is the high limit in milli-units, SHT40X_ALARM_NO_HIGH to disable
+ * @param[in] s32Hysteresis is how far back inside the limits a value must come to clear the alarm, in milli-units
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid channel, low above high or negative hysteresis
+ *            - 2 pAlarm is NULL
+ * @note      the limits are turned into ticks here once, a limit the sensor cannot reach is disabled.
+ *            The channel returns to NORMAL without a callback.
+ */
+uint8_t sht40x_alarm_set_limits(sht40x_alarm_t *const pAlarm, sht40x_alarm_channel_t channel,
+                                int32_t s32Low, int32_t s32High, int32_t s32Hysteresis);
+
+/**
+ * @brief     This function runs one sample through both channels
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] *pTicks points to the raw sample
+ * @return  status code
+ *            - 0 success
+ *            - 2 pAlarm or pTicks is NULL
+ * @note      integer compares only, the callback runs from here
+ */
+uint8_t sht40x_alarm_process(sht40x_alarm_t *const pAlarm, const sht40x_ticks_t *pTicks);
+
+/**
+ * @brief     This function gets the state of a channel
+ * @param[in] *pAlarm points to the alarm structure
+ * @param[in] channel is the channel to read
+ * @param[out] *pState points to the state
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid channel
+ *            - 2 pAlarm or pState is NULL
+ * @note      none
+ */
+uint8_t sht40x_alarm_get_state(const sht40x_alarm_t *const pAlarm, sht40x_alarm_channel_t channel, sht40x_alarm_state_t *pState);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_ALARM_H_INCLUDED
@@ -0,0 +1,337 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_async.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:10 PM
+ */
+
+#include "sht40x_driver_async.h"
+
+/**
+* @brief publication of the operation state
+* @note  the completion context stores status and frame before it releases SHT40X_ASYNC_IDLE, a
+*        caller that acquires SHT40X_ASYNC_IDLE then sees them. Compilers without the GCC atomic
+*        builtins only get the volatile access, see sht40x_async_t.
+*/
+#if defined(__GNUC__)
+#define SHT40X_ASYNC_STATE_SET(pAsync, STATE)   __atomic_store_n(&(pAsync)->state, (uint8_t)(STATE), __ATOMIC_RELEASE)    /**< release store */
+#define SHT40X_ASYNC_STATE_GET(pAsync)          __atomic_load_n(&(pAsync)->state, __ATOMIC_ACQUIRE)                       /**< acquire load */
+#else
+#define SHT40X_ASYNC_STATE_SET(pAsync, STATE)   ((pAsync)->state = (uint8_t)(STATE))                                       /**< volatile store */
+#define SHT40X_ASYNC_STATE_GET(pAsync)          ((pAsync)->state)                                                          /**< volatile load */
+#endif // __GNUC__
+
+static void a_sht40x_async_on_command(void *pContext, uint8_t u8Status);
+static void a_sht40x_async_on_timer(void *pContext, uint8_t u8Status);
+static void a_sht40x_async_on_read(void *pContext, uint8_t u8Status);
+
+/**
+* @brief This function ends the running operation and reports it
+* @param[in] *pAsync points to the async structure
+* @param[in] u8Status is the operation status
+* @return none
+* @note the structure is idle before the callback runs, so the callback may start the next operation
+*/
+static void a_sht40x_async_finish(sht40x_async_t *const pAsync, uint8_t u8Status)
+{
+    pAsync->status = u8Status;
+    SHT40X_ASYNC_STATE_SET(pAsync, SHT40X_ASYNC_IDLE);     /**< publishes status and frame */
+    if(pAsync->callback != NULL)
+        pAsync->callback(pAsync, u8Status);
+}
+
+/**
+* @brief This function submits the wait before the next read
+* @param[in] *pAsync points to the async structure
+* @param[in] u32Ms is the time to wait in milliseconds
+* @return none
+* @note the state is set before submitting, the completion may run before submit returns
+*/
+static void a_sht40x_async_wait(sht40x_async_t *const pAsync, uint32_t u32Ms)
+{
+    const sht40x_async_transport_t *pTransport = pAsync->pTransport;
+
+    SHT40X_ASYNC_STATE_SET(pAsync, SHT40X_ASYNC_WAIT);
+    pAsync->waited += (uint16_t)u32Ms;
+    pAsync->submits++;
+    if(pTransport->submit_timer(pTransport->pBus, u32Ms, a_sht40x_async_on_timer, pAsync) != 0)
+        a_sht40x_async_finish(pAsync, 1);
+}
+
+/**
+* @brief This function tells whether the running operation is a measurement
+* @param[in] *pAsync points to the async structure
+* @return 1 for a measurement, 0 for a heater pulse
+* @note none
+*/
+static uint8_t a_sht40x_async_is_measurement(const sht40x_async_t *const pAsync)
+{
+    return ((pAsync->index <= SHT40X_PRECISION_LOWEST) && (pAsync->cmd == READ_PRECISION[pAsync->index])) ? 1 : 0;
+}
+
+/**
+* @brief This function submits the command of a new operation
+* @param[in] *pAsync points to the async structure
+* @param[in] u8Cmd is the command to write
+* @param[in] u8Index is the command index in its table (precision or heater power)
+* @param[in] u16Delay_ms is the maximum time the device needs before the response is ready
+* @return status code
+*          - 0 success
+*          - 1 an operation is running or the transport refused the command
+* @note none
+*/
+static uint8_t a_sht40x_async_start(sht40x_async_t *const pAsync, uint8_t u8Cmd, uint8_t u8Index, uint16_t u16Delay_ms)
+{
+    const sht40x_async_transport_t *pTransport = pAsync->pTransport;
+
+    if(SHT40X_ASYNC_STATE_GET(pAsync) != SHT40X_ASYNC_IDLE)
+        return 1;       /**< busy */
+
+    pAsync->cmd = u8Cmd;
+    pAsync->index = u8Index;
+    pAsync->delay = u16Delay_ms;
+    pAsync->waited = 0;
+    pAsync->nacked = 0;
+    SHT40X_ASYNC_STATE_SET(pAsync, SHT40X_ASYNC_COMMAND);
+    pAsync->submits++;
+    if(pTransport->submit_write(pTransport->pBus, pAsync->pHandle->i2c_address, &pAsync->cmd, 1, a_sht40x_async_on_command, pAsync) != 0)
+    {
+        pAsync->status = 1;
+        SHT40X_ASYNC_STATE_SET(pAsync, SHT40X_ASYNC_IDLE);
+        return 1;       /**< refused, nothing will complete */
+    }
+
+    return 0;
+}
+
+/**
+* @brief This function continues an operation once its command is written
+* @param[in] *pContext points to the async structure
+* @param[in] u8Status is the write status
+* @return none
+* @note the conversion time is the learned one in ready polling mode, the datasheet maximum otherwise
+*/
+static void a_sht40x_async_on_command(void *pContext, uint8_t u8Status)
+{
+    sht40x_async_t *pAsync = (sht40x_async_t *)pContext;
+    uint8_t u8Wait;
+
+    sht40x_hook_write(pAsync->pHandle, pAsync->cmd, u8Status);
+    if(u8Status != 0)
+    {
+        a_sht40x_async_finish(pAsync, 1);
+        return;
+    }
+    if((a_sht40x_async_is_measurement(pAsync) == 0) ||
+       (sht40x_get_conversion_time(pAsync->pHandle, (sht40x_precision_t)pAsync->index, &u8Wait) != 0))
+    {
+        a_sht40x_async_wait(pAsync, pAsync->delay);     /**< heater pulse */
+        return;
+    }
+    a_sht40x_async_wait(pAsync, u8Wait);
+}
+
+/**
+* @brief This function reads the response once the wait elapsed
+* @param[in] *pContext points to the async structure
+* @param[in] u8Status is the timer status
+* @return none
+* @note none
+*/
+static void a_sht40x_async_on_timer(void *pContext, uint8_t u8Status)
+{
+    sht40x_async_t *pAsync = (sht40x_async_t *)pContext;
+    const sht40x_async_transport_t *pTransport = pAsync->pTransport;
+
+    if(u8Status != 0)
+    {
+        a_sht40x_async_finish(pAsync, 1);
+        return;
+    }
+
+    SHT40X_ASYNC_STATE_SET(pAsync, SHT40X_ASYNC_READ);
+    pAsync->submits++;
+    if(pTransport->submit_read(pTransport->pBus, pAsync->pHandle->i2c_address, pAsync->frame, RESPONSE_LENGTH, a_sht40x_async_on_read, pAsync) != 0)
+        a_sht40x_async_finish(pAsync, 1);
+}
+
+/**
+* @brief This function checks the response and ends the operation
+* @param[in] *pContext points to the async structure
+* @param[in] u8Status is the read status
+* @return none
+* @note a NACK is retried in ready polling mode until the max time plus MEASUREMENT_POLL_MARGIN elapsed,
+*       the CRC check, the alarm and the conversion time learning are the ones of the handle
+*/
+static void a_sht40x_async_on_read(void *pContext, uint8_t u8Status)
+{
+    sht40x_async_t *pAsync = (sht40x_async_t *)pContext;
+    uint8_t err;
+
+    if((u8Status != 0) && (pAsync->pHandle->ready_poll == 1) && (pAsync->waited <= (uint32_t)pAsync->delay + MEASUREMENT_POLL_MARGIN))
+        u8Status = SHT40X_DRV_NOT_READY;        /**< address NACKed, device still busy */
+    else if(u8Status != 0)
+        u8Status = 1;
+
+    err = sht40x_hook_read(pAsync->pHandle, pAsync->cmd, pAsync->frame, u8Status, pAsync->waited, pAsync->nacked);
+    if(err == SHT40X_DRV_NOT_READY)
+    {
+        pAsync->nacked = 1;
+        a_sht40x_async_wait(pAsync, MEASUREMENT_POLL_DELAY);
+        return;
+    }
+
+    a_sht40x_async_finish(pAsync, err);
+}
+
+/**
+ * @brief     This function initializes an async operation
+ * @param[in] *pAsync points to the async structure
+ * @param[in] *pHandle points to an initialized sht40x handle
+ * @param[in] *pTransport points to the async transport
+ * @param[in] callback is called when an operation finished, from the completion context
+ * @param[in] *pContext is kept for the callback
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL or a submit function is not linked
+ *            - 3 pHandle is not initialized
+ * @note      none
+ */
+uint8_t sht40x_async_init(sht40x_async_t *const pAsync, sht40x_handle_t *const pHandle, const sht40x_async_transport_t *pTransport,
+                          void (*callback)(sht40x_async_t *pAsync, uint8_t u8Status), void *pContext)
+{
+    if((pAsync == NULL) || (pHandle == NULL) || (pTransport == NULL))
+        return 2;
+    if((pTransport->submit_write == NULL) || (pTransport->submit_read == NULL) || (pTransport->submit_timer == NULL))
+        return 2;
+    if(pHandle->inited != 1)
+        return 3;
+
+    memset(pAsync, 0, sizeof(sht40x_async_t));
+    pAsync->pHandle = pHandle;
+    pAsync->pTransport = pTransport;
+    pAsync->callback = callback;
+    pAsync->pContext = pContext;
+    pAsync->status = 1;     /**< nothing measured yet */
+
+    return 0;
+}
+
+/**
+ * @brief     This function starts a temperature and humidity measurement
+ * @param[in] *pAsync points to the async structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success, the callback reports the result
+ *            - 1 an operation is running, invalid precision or the transport refused the command
+ *            - 2 pAsync is NULL
+ * @note      command, conversion timer, then read. In ready polling mode the learned conversion
+ *            time is waited and a NACKed read is retried every MEASUREMENT_POLL_DELAY ms.
+ *            The callback may start the next operation.
+ */
+uint8_t sht40x_async_start_measurement(sht40x_async_t *const pAsync, sht40x_precision_t precision)
+{
+    if(pAsync == NULL)
+        return 2;
+    if(precision > SHT40X_PRECISION_LOWEST)
+        return 1;
+
+    return a_sht40x_async_start(pAsync, READ_PRECISION[precision], precision, MEASUREMENT_DELAY[precision]);
+}
+
+/**
+ * @brief     This function starts a heater pulse followed by a high precision measurement
+ * @param[in] *pAsync points to the async structure
+ * @param[in] power is the heater power and duration
+ * @return  status code
+ *            - 0 success, the callback reports the result
+ *            - 1 an operation is running, invalid power or the transport refused the command
+ *            - 2 pAsync is NULL
+ * @note      the heater_callback of the handle is not called
+ */
+uint8_t sht40x_async_start_heater(sht40x_async_t *const pAsync, sht40x_heater_power_t power)
+{
+    if(pAsync == NULL)
+        return 2;
+    if(power > SHT40X_HEATER_POWER_20mW_100mS)
+        return 1;
+
+    return a_sht40x_async_start(pAsync, HEATER_POWER[power], power, HEATER_DELAY[power]);
+}
+
+/**
+ * @brief     This function gets the raw ticks of the last operation
+ * @param[in] *pAsync points to the async structure
+ * @param[out] *pTicks points to the raw ticks
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed
+ *            - 2 a pointer is NULL
+ *            - 4 an operation is running
+ *            - 5 CRC mismatch in the received data
+ * @note      none
+ */
+uint8_t sht40x_async_get_ticks(const sht40x_async_t *const pAsync, sht40x_ticks_t *pTicks)
+{
+    if((pAsync == NULL) || (pTicks == NULL))
+        return 2;
+    if(SHT40X_ASYNC_STATE_GET(pAsync) != SHT40X_ASYNC_IDLE)
+        return SHT40X_DRV_NOT_READY;      /**< acquires status and frame once idle */
+    if(pAsync->status != 0)
+        return pAsync->status;
+
+    pTicks->temperature = ((uint16_t)pAsync->frame[0] << 8) | pAsync->frame[1];
+    pTicks->humidity = ((uint16_t)pAsync->frame[3] << 8) | pAsync->frame[4];
+
+    return 0;
+}
+
+/**
+ * @brief     This function gets the converted data of the last operation
+ * @param[in] *pAsync points to the async structure
+ * @param[out] *pData points to the sensor data
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed
+ *            - 2 a pointer is NULL
+ *            - 4 an operation is running
+ *            - 5 CRC mismatch in the received data
+ * @note      none
+ */
+uint8_t sht40x_async_get_data(const sht40x_async_t *const pAsync, sht40x_data_t *pData)
+{
+    uint8_t err;
+    sht40x_ticks_t ticks;
+
+    if(pData == NULL)
+        return 2;
+
+    err = sht40x_async_get_ticks(pAsync, &ticks);
+    if(err != 0)
+        return err;
+
+    (void)sht40x_convert_ticks(ticks.temperature, ticks.humidity, pData);
+    memcpy(pData->rawData, pAsync->frame, RESPONSE_LENGTH);      /**< the frame as received */
+
+    return 0;
+}
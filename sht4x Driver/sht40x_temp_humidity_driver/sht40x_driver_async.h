@@ -0,0 +1,176 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_async.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:10 PM
+ */
+
+#ifndef SHT40X_DRIVER_ASYNC_H_INCLUDED
+#define SHT40X_DRIVER_ASYNC_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_async_driver sht40x asynchronous transport function
+ * @brief    measurement and heater sequences driven by transfer completions (DMA, interrupt, thread)
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+* @brief sht40x async completion function definition
+* @note  u8Status is 0 when the transfer or timer succeeded, 1 otherwise
+*/
+typedef void (*sht40x_async_complete_t)(void *pContext, uint8_t u8Status);
+
+/**
+* @brief sht40x async transport structure definition
+* @note  a submit function returns 0 when it accepted the request, complete is then called exactly
+*        once, from any context and possibly before submit returns. buf stays valid until then.
+*        A non zero return means the request was refused and complete is never called.
+*/
+typedef struct sht40x_async_transport_s
+{
+    void *pBus;                                                                                 /**< user bus context passed to the submit functions */
+    uint8_t (*submit_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len,
+                            sht40x_async_complete_t complete, void *pContext);                  /**< point to a i2c write submit function address */
+    uint8_t (*submit_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len,
+                           sht40x_async_complete_t complete, void *pContext);                   /**< point to a i2c read submit function address */
+    uint8_t (*submit_timer)(void *bus, uint32_t u32Ms, sht40x_async_complete_t complete,
+                            void *pContext);                                                    /**< point to a one shot timer submit function address */
+} sht40x_async_transport_t;
+
+ /**
+ * @brief sht40x async state enumeration
+ */
+typedef enum
+{
+    SHT40X_ASYNC_IDLE    = 0x00,                                      /**< no operation running */
+    SHT40X_ASYNC_COMMAND = 0x01,                                      /**< command write submitted */
+    SHT40X_ASYNC_WAIT    = 0x02,                                      /**< conversion or heater timer submitted */
+    SHT40X_ASYNC_READ    = 0x03                                       /**< response read submitted */
+} sht40x_async_state_t;
+
+/**
+* @brief sht40x async operation structure definition
+* @note  one per sensor, runs one operation at a time. The handle provides the address, the
+*        learned conversion times and the alarm, its blocking functions must not run meanwhile.
+*        Every transfer is reported through sht40x_hook_write and sht40x_hook_read, so the
+*        statistics, trace and log of the handle cover the async operations too.
+*        The completion context publishes status and frame by a release store of the state,
+*        sht40x_async_get_ticks reads them after an acquire load (GCC atomic builtins). With
+*        other compilers only the callback is ordered after the results: read them there, or
+*        hand them over under a lock. Start operations from one context only.
+*/
+typedef struct sht40x_async_s
+{
+    sht40x_handle_t *pHandle;                                         /**< initialized sensor handle */
+    const sht40x_async_transport_t *pTransport;                       /**< transport the transfers are submitted to */
+    void (*callback)(struct sht40x_async_s *pAsync, uint8_t u8Status);   /**< operation completion function */
+    void *pContext;                                                   /**< caller data for the callback */
+    volatile uint8_t state;                                           /**< sht40x_async_state_t, stored with release, loaded with acquire */
+    uint8_t cmd;                                                      /**< command of the running operation */
+    uint8_t index;                                                    /**< precision or heater power of the running operation */
+    uint8_t status;                                                   /**< status of the last finished operation */
+    uint16_t delay;                                                   /**< max time the device needs (ms) */
+    uint16_t waited;                                                  /**< time waited since the command (ms) */
+    uint8_t nacked;                                                   /**< a read of the running operation was NACKed */
+    uint8_t frame[RESPONSE_LENGTH];                                   /**< response frame, read by DMA */
+    uint32_t submits;                                                 /**< requests submitted to the transport */
+} sht40x_async_t;
+
+/**
+ * @brief     This function initializes an async operation
+ * @param[in] *pAsync points to the async structure
+ * @param[in] *pHandle points to an initialized sht40x handle
+ * @param[in] *pTransport points to the async transport
+ * @param[in] callback is called when an operation finished, from the completion context
+ * @param[in] *pContext is kept for the callback
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL or a submit function is not linked
+ *            - 3 pHandle is not initialized
+ * @note      none
+ */
+uint8_t sht40x_async_init(sht40x_async_t *const pAsync, sht40x_handle_t *const pHandle, const sht40x_async_transport_t *pTransport,
+                          void (*callback)(sht40x_async_t *pAsync, uint8_t u8Status), void *pContext);
+
+/**
+ * @brief     This function starts a temperature and humidity measurement
+ * @param[in] *pAsync points to the async structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success, the callback reports the result
+ *            - 1 an operation is running, invalid precision or the transport refused the command
+ *            - 2 pAsync is NULL
+ * @note      command, conversion timer, then read. In ready polling mode the learned conversion
+ *            time is waited and a NACKed read is retried every MEASUREMENT_POLL_DELAY ms.
+ *            The callback may start the next operation.
+ */
+uint8_t sht40x_async_start_measurement(sht40x_async_t *const pAsync, sht40x_precision_t precision);
+
+/**
+ * @brief     This function starts a heater pulse followed by a high precision measurement
+ * @param[in] *pAsync points to the async structure
+ * @param[in] power is the heater power and duration
+ * @return  status code
+ *            - 0 success, the callback reports the result
+ *            - 1 an operation is running, invalid power or the transport refused the command
+ *            - 2 pAsync is NULL
+ * @note      the heater_callback of the handle is not called
+ */
+uint8_t sht40x_async_start_heater(sht40x_async_t *const pAsync, sht40x_heater_power_t power);
+
+/**
+ * @brief     This function gets the raw ticks of the last operation
+ * @param[in] *pAsync points to the async structure
+ * @param[out] *pTicks points to the raw ticks
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed
+ *            - 2 a pointer is NULL
+ *            - 4 an operation is running
+ *            - 5 CRC mismatch in the received data
+ * @note      none
+ */
+uint8_t sht40x_async_get_ticks(const sht40x_async_t *const pAsync, sht40x_ticks_t *pTicks);
+
+/**
+ * @brief     This function gets the converted data of the last operation
+ * @param[in] *pAsync points to the async structure
+ * @param[out] *pData points to the sensor data
+ * @return  status code
+ *            - 0 success
+ *            - 1 the last operation failed
+ *            - 2 a pointer is NULL
+ *            - 4 an operation is running
+ *            - 5 CRC mismatch in the received data
+ * @note      none
+ */
+uint8_t sht40x_async_get_data(const sht40x_async_t *const pAsync, sht40x_data_t *pData);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_ASYNC_H_INCLUDED
@@ -0,0 +1,318 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_async_thread.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:25 PM
+ */
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L     /**< clock_gettime and pthread_condattr_setclock under -std=c99 */
+#endif
+
+#include "sht40x_driver_async_thread.h"
+
+#ifdef __linux__
+
+#include <time.h>
+
+#define SHT40X_ASYNC_OP_FREE            0U              /**< request slot unused */
+#define SHT40X_ASYNC_OP_WRITE           1U              /**< blocking write */
+#define SHT40X_ASYNC_OP_READ            2U              /**< blocking read */
+#define SHT40X_ASYNC_OP_TIMER           3U              /**< nothing to transfer, completes when due */
+
+/**
+* @brief This function returns the monotonic time in nanoseconds
+* @return time in nanoseconds
+* @note none
+*/
+static uint64_t a_sht40x_async_thread_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+* @brief This function queues a request
+* @param[in] *pThread points to the worker structure
+* @param[in] *pRequest points to the request to copy, due_ns holds the delay
+* @return status code
+*          - 0 queued
+*          - 1 queue full or worker stopped
+* @note none
+*/
+static uint8_t a_sht40x_async_thread_submit(sht40x_async_thread_t *const pThread, sht40x_async_request_t *pRequest)
+{
+    uint8_t index;
+    uint8_t err = 1;
+
+    if(pThread->stopped == 1)
+    {
+        pThread->refused++;
+        return 1;       /**< the worker is joined, only the stopping thread gets here */
+    }
+    pRequest->due_ns += a_sht40x_async_thread_now_ns();
+
+    pthread_mutex_lock(&pThread->lock);
+    for(index = 0; (pThread->running == 1) && (index < SHT40X_ASYNC_THREAD_QUEUE); index++)
+    {
+        if(pThread->queue[index].op == SHT40X_ASYNC_OP_FREE)
+        {
+            pRequest->sequence = pThread->sequence++;
+            pThread->queue[index] = *pRequest;
+            pthread_cond_signal(&pThread->wake);
+            err = 0;
+            break;
+        }
+    }
+    if(err != 0)
+        pThread->refused++;
+    pthread_mutex_unlock(&pThread->lock);
+
+    return err;
+}
+
+/**
+* @brief This function finds the request to run next
+* @param[in] *pThread points to the worker structure
+* @return slot index, SHT40X_ASYNC_THREAD_QUEUE when the queue is empty
+* @note called with the lock held, earliest due time first, then submit order
+*/
+static uint8_t a_sht40x_async_thread_next(sht40x_async_thread_t *const pThread)
+{
+    uint8_t index;
+    uint8_t best = SHT40X_ASYNC_THREAD_QUEUE;
+    const sht40x_async_request_t *pQueue = pThread->queue;
+
+    for(index = 0; index < SHT40X_ASYNC_THREAD_QUEUE; index++)
+    {
+        if(pQueue[index].op == SHT40X_ASYNC_OP_FREE)
+            continue;
+        if((best == SHT40X_ASYNC_THREAD_QUEUE) || (pQueue[index].due_ns < pQueue[best].due_ns) ||
+           ((pQueue[index].due_ns == pQueue[best].due_ns) && ((int32_t)(pQueue[index].sequence - pQueue[best].sequence) < 0)))
+            best = index;
+    }
+
+    return best;
+}
+
+/**
+* @brief This function is the worker loop
+* @param[in] *pArg points to the worker structure
+* @return NULL
+* @note the lock is released while a transfer or a completion runs, so completions may submit
+*/
+static void *a_sht40x_async_thread_main(void *pArg)
+{
+    sht40x_async_thread_t *pThread = (sht40x_async_thread_t *)pArg;
+    sht40x_async_request_t request;
+    struct timespec ts;
+    uint64_t u64Now;
+    uint8_t index;
+    uint8_t u8Status;
+
+    pthread_mutex_lock(&pThread->lock);
+    while(pThread->running == 1)
+    {
+        index = a_sht40x_async_thread_next(pThread);
+        if(index == SHT40X_ASYNC_THREAD_QUEUE)
+        {
+            pthread_cond_wait(&pThread->wake, &pThread->lock);
+            continue;
+        }
+        u64Now = a_sht40x_async_thread_now_ns();
+        if(pThread->queue[index].due_ns > u64Now)
+        {
+            ts.tv_sec = (time_t)(pThread->queue[index].due_ns / 1000000000ULL);
+            ts.tv_nsec = (long)(pThread->queue[index].due_ns % 1000000000ULL);
+            (void)pthread_cond_timedwait(&pThread->wake, &pThread->lock, &ts);
+            continue;   /**< a sooner request may have arrived */
+        }
+
+        request = pThread->queue[index];
+        pThread->queue[index].op = SHT40X_ASYNC_OP_FREE;
+        pthread_mutex_unlock(&pThread->lock);
+
+        if(request.op == SHT40X_ASYNC_OP_WRITE)
+            u8Status = (pThread->i2c_write(pThread->pBus, request.address, request.pBuf, request.length) != 0) ? 1 : 0;
+        else if(request.op == SHT40X_ASYNC_OP_READ)
+            u8Status = (pThread->i2c_read(pThread->pBus, request.address, request.pBuf, request.length) != 0) ? 1 : 0;
+        else
+            u8Status = 0;
+        request.complete(request.pContext, u8Status);
+
+        pthread_mutex_lock(&pThread->lock);
+        pThread->completed++;
+    }
+    pthread_mutex_unlock(&pThread->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief     This function starts a worker thread transport
+ * @param[in] *pThread points to the worker structure
+ * @param[in] *pBus is the blocking bus context
+ * @param[in] i2c_read is the blocking i2c read function
+ * @param[in] i2c_write is the blocking i2c write function
+ * @return  status code
+ *            - 0 success
+ *            - 1 thread creation failed
+ *            - 2 a pointer is NULL
+ * @note      the blocking bus is initialized by the caller, any transport fits (linux, sim, mock)
+ */
+uint8_t sht40x_async_thread_start(sht40x_async_thread_t *const pThread, void *pBus,
+                                  uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len),
+                                  uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len))
+{
+    pthread_condattr_t attr;
+
+    if((pThread == NULL) || (i2c_read == NULL) || (i2c_write == NULL))
+        return 2;
+
+    memset(pThread, 0, sizeof(sht40x_async_thread_t));
+    pThread->transport.pBus = pThread;
+    pThread->transport.submit_write = sht40x_async_thread_submit_write;
+    pThread->transport.submit_read = sht40x_async_thread_submit_read;
+    pThread->transport.submit_timer = sht40x_async_thread_submit_timer;
+    pThread->pBus = pBus;
+    pThread->i2c_read = i2c_read;
+    pThread->i2c_write = i2c_write;
+    pThread->running = 1;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);     /**< due times are monotonic */
+    pthread_cond_init(&pThread->wake, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&pThread->lock, NULL);
+    if(pthread_create(&pThread->thread, NULL, a_sht40x_async_thread_main, pThread) != 0)
+    {
+        pThread->running = 0;
+        pThread->stopped = 1;
+        pthread_cond_destroy(&pThread->wake);
+        pthread_mutex_destroy(&pThread->lock);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     This function stops a worker thread transport
+ * @param[in] *pThread points to the worker structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pThread is NULL
+ * @note      requests still queued complete with status 1, must not be called from a completion
+ */
+uint8_t sht40x_async_thread_stop(sht40x_async_thread_t *const pThread)
+{
+    uint8_t index;
+
+    if(pThread == NULL)
+        return 2;
+
+    pthread_mutex_lock(&pThread->lock);
+    pThread->running = 0;
+    pthread_cond_signal(&pThread->wake);
+    pthread_mutex_unlock(&pThread->lock);
+    pthread_join(pThread->thread, NULL);
+
+    for(index = 0; index < SHT40X_ASYNC_THREAD_QUEUE; index++)
+    {
+        if(pThread->queue[index].op != SHT40X_ASYNC_OP_FREE)
+        {
+            pThread->queue[index].op = SHT40X_ASYNC_OP_FREE;
+            pThread->queue[index].complete(pThread->queue[index].pContext, 1);     /**< submits are refused from now on */
+            pThread->completed++;
+        }
+    }
+    pThread->stopped = 1;
+    pthread_cond_destroy(&pThread->wake);
+    pthread_mutex_destroy(&pThread->lock);
+
+    return 0;
+}
+
+/**
+ * @brief  write submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  addr is the 7 bit address
+ * @param[in]  *pBuf points to the data to write
+ * @param[in]  u8Length is the number of bytes to write
+ * @param[in]  complete is called from the worker once written
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length,
+                                         sht40x_async_complete_t complete, void *pContext)
+{
+    sht40x_async_request_t request = { SHT40X_ASYNC_OP_WRITE, addr, u8Length, pBuf, 0, 0, complete, pContext };
+
+    return a_sht40x_async_thread_submit((sht40x_async_thread_t *)pBus, &request);
+}
+
+/**
+ * @brief  read submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  addr is the 7 bit address
+ * @param[out] *pBuf points to the data read, filled before complete runs
+ * @param[in]  u8Length is the number of bytes to read
+ * @param[in]  complete is called from the worker once read
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length,
+                                        sht40x_async_complete_t complete, void *pContext)
+{
+    sht40x_async_request_t request = { SHT40X_ASYNC_OP_READ, addr, u8Length, pBuf, 0, 0, complete, pContext };
+
+    return a_sht40x_async_thread_submit((sht40x_async_thread_t *)pBus, &request);
+}
+
+/**
+ * @brief  timer submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  u32Ms is the time to wait in milliseconds
+ * @param[in]  complete is called from the worker once elapsed
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_timer(void *pBus, uint32_t u32Ms, sht40x_async_complete_t complete, void *pContext)
+{
+    sht40x_async_request_t request = { SHT40X_ASYNC_OP_TIMER, 0, 0, NULL, (uint64_t)u32Ms * 1000000ULL, 0, complete, pContext };
+
+    return a_sht40x_async_thread_submit((sht40x_async_thread_t *)pBus, &request);
+}
+
+#endif // __linux__
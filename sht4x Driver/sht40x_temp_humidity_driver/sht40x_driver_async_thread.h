@@ -0,0 +1,160 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_async_thread.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:25 PM
+ */
+
+#ifndef SHT40X_DRIVER_ASYNC_THREAD_H_INCLUDED
+#define SHT40X_DRIVER_ASYNC_THREAD_H_INCLUDED
+
+#include "sht40x_driver_async.h"
+
+#ifdef __linux__
+
+#include <pthread.h>
+
+/**
+ * @defgroup sht40x_async_thread_driver sht40x worker thread async transport function
+ * @brief    async transport completing the transfers of a blocking transport from a worker thread
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_ASYNC_THREAD_QUEUE       16U             /**< requests a worker can hold */
+
+/**
+* @brief sht40x worker request structure definition
+*/
+typedef struct sht40x_async_request_s
+{
+    uint8_t op;                                                       /**< 0 free, 1 write, 2 read, 3 timer */
+    uint8_t address;                                                  /**< 7 bit address */
+    uint8_t length;                                                   /**< bytes to transfer */
+    uint8_t *pBuf;                                                    /**< caller buffer */
+    uint64_t due_ns;                                                  /**< monotonic time the request runs at */
+    uint32_t sequence;                                                /**< submit order, breaks ties between equal due times */
+    sht40x_async_complete_t complete;                                 /**< completion function */
+    void *pContext;                                                   /**< completion context */
+} sht40x_async_request_t;
+
+/**
+* @brief sht40x worker thread transport structure definition
+* @note  link transport to sht40x_async_init. Transfers run in submit order, timers run when due
+*        without holding transfers back, every completion is called from the worker thread.
+*/
+typedef struct sht40x_async_thread_s
+{
+    sht40x_async_transport_t transport;                               /**< async contract, pBus points back to this structure */
+    void *pBus;                                                       /**< blocking bus context */
+    uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);    /**< blocking i2c read function */
+    uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);   /**< blocking i2c write function */
+    pthread_t thread;                                                 /**< worker */
+    pthread_mutex_t lock;                                             /**< protects the queue */
+    pthread_cond_t wake;                                              /**< signaled on submit and stop, monotonic clock */
+    sht40x_async_request_t queue[SHT40X_ASYNC_THREAD_QUEUE];         /**< pending requests */
+    uint32_t sequence;                                                /**< next submit order */
+    uint8_t running;                                                  /**< 0 asks the worker to stop */
+    uint8_t stopped;                                                  /**< lock destroyed, submits refused without it */
+    uint32_t completed;                                               /**< completions called */
+    uint32_t refused;                                                 /**< submits refused, queue full or stopped */
+} sht40x_async_thread_t;
+
+/**
+ * @brief     This function starts a worker thread transport
+ * @param[in] *pThread points to the worker structure
+ * @param[in] *pBus is the blocking bus context
+ * @param[in] i2c_read is the blocking i2c read function
+ * @param[in] i2c_write is the blocking i2c write function
+ * @return  status code
+ *            - 0 success
+ *            - 1 thread creation failed
+ *            - 2 a pointer is NULL
+ * @note      the blocking bus is initialized by the caller, any transport fits (linux, sim, mock)
+ */
+uint8_t sht40x_async_thread_start(sht40x_async_thread_t *const pThread, void *pBus,
+                                  uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len),
+                                  uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len));
+
+/**
+ * @brief     This function stops a worker thread transport
+ * @param[in] *pThread points to the worker structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pThread is NULL
+ * @note      requests still queued complete with status 1, must not be called from a completion
+ */
+uint8_t sht40x_async_thread_stop(sht40x_async_thread_t *const pThread);
+
+/**
+ * @brief  write submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  addr is the 7 bit address
+ * @param[in]  *pBuf points to the data to write
+ * @param[in]  u8Length is the number of bytes to write
+ * @param[in]  complete is called from the worker once written
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length,
+                                         sht40x_async_complete_t complete, void *pContext);
+
+/**
+ * @brief  read submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  addr is the 7 bit address
+ * @param[out] *pBuf points to the data read, filled before complete runs
+ * @param[in]  u8Length is the number of bytes to read
+ * @param[in]  complete is called from the worker once read
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length,
+                                        sht40x_async_complete_t complete, void *pContext);
+
+/**
+ * @brief  timer submit function of the worker thread transport
+ * @param[in]  *pBus points to a sht40x_async_thread_t
+ * @param[in]  u32Ms is the time to wait in milliseconds
+ * @param[in]  complete is called from the worker once elapsed
+ * @param[in]  *pContext is passed to complete
+ * @return status code
+ *         - 0 queued
+ *         - 1 queue full or worker stopped
+ * @note   none
+ */
+uint8_t sht40x_async_thread_submit_timer(void *pBus, uint32_t u32Ms, sht40x_async_complete_t complete, void *pContext);
+
+/**
+ * @}
+ */
+
+#endif // __linux__
+
+#endif // SHT40X_DRIVER_ASYNC_THREAD_H_INCLUDED
@@ -26,10 +26,13 @@
  */
 
 #include "sht40x_driver_basic.h"
+#include "sht40x_driver_filter.h"
 
 
 /**
  * @brief basic example initialize
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] pBus is the bus context given to the interface i2c functions
  * @param[in] variant is the device type
  * @return status code
  *          - 0 success
@@ -37,62 +40,65 @@
  * @note    none
  */
 
-uint8_t sht40x_basic_initialize(sht40x_variant_t variant)
+uint8_t sht40x_basic_initialize(sht40x_handle_t *const pHandle, void *pBus, sht40x_variant_t variant)
 {
     int err;
 
     /*link function*/
-    DRIVER_SHT40X_LINK_INIT(&sht40x_handler, sht40x_handle_t);                               /**< Link the  */
-    DRIVER_SHT40X_LINK_I2C_INIT(&sht40x_handler, sht40x_interface_i2c_init);                 /**< Link the i2c initialize function */
-    DRIVER_SHT40X_LINK_I2C_DEINIT(&sht40x_handler, sht40x_interface_i2c_deinit);             /**< Link the the i2c de-initialize function */
-    DRIVER_SHT40X_LINK_I2C_WRITE(&sht40x_handler, sht40x_interface_i2c_write);               /**< Link the i2c  write function */
-    DRIVER_SHT40X_LINK_I2C_READ(&sht40x_handler, sht40x_interface_i2c_read);                 /**< Link the i2c read function */
-    DRIVER_SHT40X_LINK_DELAY_MS(&sht40x_handler,sht40x_interface_delay_ms);                  /**< Link delay function */
-    DRIVER_SHT40X_LINK_DEBUG_PRINT(&sht40x_handler, sht40x_interface_debug_print);           /**< Link the the debug print function */
+    DRIVER_SHT40X_LINK_INIT(pHandle, sht40x_handle_t);                               /**< Link the  */
+    DRIVER_SHT40X_LINK_I2C_INIT(pHandle, sht40x_interface_i2c_init);                 /**< Link the i2c initialize function */
+    DRIVER_SHT40X_LINK_I2C_DEINIT(pHandle, sht40x_interface_i2c_deinit);             /**< Link the the i2c de-initialize function */
+    DRIVER_SHT40X_LINK_I2C_WRITE(pHandle, sht40x_interface_i2c_write);               /**< Link the i2c  write function */
+    DRIVER_SHT40X_LINK_I2C_READ(pHandle, sht40x_interface_i2c_read);                 /**< Link the i2c read function */
+    DRIVER_SHT40X_LINK_I2C_BUS(pHandle, pBus);                                       /**< Link the i2c bus this sensor sits on */
+    DRIVER_SHT40X_LINK_DELAY_MS(pHandle,sht40x_interface_delay_ms);                  /**< Link delay function */
+    DRIVER_SHT40X_LINK_DEBUG_PRINT(pHandle, sht40x_interface_debug_print);           /**< Link the the debug print function */
 
     /* sht40x initialize */
-    err = sht40x_init(&sht40x_handler);
+    err = sht40x_init(pHandle);
     if(err)
     {
         return err;   /**< return error status*/
     }
 
     /* set device variant */
-    err = sht40x_set_variant(&sht40x_handler, variant);
+    err = sht40x_set_variant(pHandle, variant);
     if(err)
     {
        return err;   /**< return error status*/
     }
 
     /** set device address */
-    err= sht40x_set_addr(&sht40x_handler);
+    err= sht40x_set_addr(pHandle);
     if(err)
     {
         return err;   /**< return error status*/
     }
 
-    sht40x_interface_delay_ms(10);         /**< wait 10 ms after initialize complete */
+    pHandle->delay_ms(10);         /**< wait 10 ms after initialize complete */
 
     return 0;   /**< success */
 }
 
 /**
  * @brief     This function get the device variant
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pVariant point to the device variant
  * @return  status code
  *            - 0 success
  *            - 1 failed to get device variant
  * @note      none
  */
-uint8_t sht40x_basic_get_variant(sht40x_variant_t *pVariant)
+uint8_t sht40x_basic_get_variant(sht40x_handle_t *const pHandle, sht40x_variant_t *pVariant)
 {
     int err;
-    err = sht40x_get_variant(&sht40x_handler, pVariant);
+    err = sht40x_get_variant(pHandle, pVariant);
     return err;   /**< return error status*/
 }
 
 /**
  * @brief     Basic implementation to read the temperature and relative humidity
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in] precision is the data read accuracy
  * @param[out] pData point to the sensor data to read
  * @return  status code
@@ -100,67 +106,149 @@ uint8_t sht40x_basic_get_variant(sht40x_variant_t *pVariant)
  *            - 1 failed to get temp/humidity
  * @note      none
  */
-uint8_t sht40x_basic_get_temp_rh(sht40x_precision_t precision, sht40x_data_t *pData)
+uint8_t sht40x_basic_get_temp_rh(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_data_t *pData)
 {
     int err;
-   err = sht40x_get_temp_rh(&sht40x_handler, precision, pData);
+   err = sht40x_get_temp_rh(pHandle, precision, pData);
    return err;   /**< return error status*/
 }
 
+/**
+ * @brief     Basic implementation to start a temperature and relative humidity measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to start measurement
+ * @note      does not wait for the conversion, see sht40x_basic_fetch_measurement
+ */
+uint8_t sht40x_basic_start_measurement(sht40x_handle_t *const pHandle, sht40x_precision_t precision)
+{
+    int err;
+    err = sht40x_start_measurement(pHandle, precision);
+    return err;   /**< return error status*/
+}
+
+/**
+ * @brief     Basic implementation to fetch a measurement started with sht40x_basic_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 4 measurement not ready yet
+ * @note      none
+ */
+uint8_t sht40x_basic_fetch_measurement(sht40x_handle_t *const pHandle, sht40x_data_t *pData)
+{
+    int err;
+    err = sht40x_fetch_measurement(pHandle, pData);
+    return err;   /**< return error status*/
+}
+
+/**
+ * @brief     Basic implementation to read the raw temperature and relative humidity ticks
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 5 CRC mismatch
+ * @note      no conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_basic_read_ticks(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_ticks_t *pTicks)
+{
+    int err;
+    err = sht40x_read_ticks(pHandle, precision, pTicks);
+    return err;   /**< return error status*/
+}
+
+/**
+ * @brief     Basic implementation to fetch the raw ticks of a measurement started with sht40x_basic_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 4 measurement not ready yet
+ *            - 5 CRC mismatch
+ * @note      no conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_basic_fetch_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks)
+{
+    int err;
+    err = sht40x_fetch_ticks(pHandle, pTicks);
+    return err;   /**< return error status*/
+}
+
 /**
  * @brief     Basic implementation to read the temperature and relative humidity with n number of samples
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in] precision is the data read accuracy
  * @param[out] pData point to the sensor data to read
  * @param[in] u8NumSample is the number of samples to read
  * @return  status code
  *            - 0 success
  *            - 1 failed to get temp/humidity
- * @note      none
+ * @note      samples are taken back to back and averaged on raw ticks, see sht40x_driver_filter.h
+ *            for a non-blocking version fed by the sampler
  */
-uint8_t sht40x_basic_get_temp_humidity_nSample(sht40x_precision_t precision, sht40x_data_t *pData, uint8_t u8NumSample)
+uint8_t sht40x_basic_get_temp_humidity_nSample(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_data_t *pData, uint8_t u8NumSample)
 {
     int index, err;
-    double temp_C_Samples = 0;
-    double humiditySamples = 0;
-    double temp_F_Samples = 0;
+    sht40x_filter_t average;
+    sht40x_ticks_t ticks;
+    sht40x_sample_t sample;
+    sht40x_sample_t result;
+
+    err = sht40x_filter_init(&average, SHT40X_FILTER_BOXCAR, u8NumSample);
+    if(err)
+    {
+        return err;   /**< return error status*/
+    }
 
     for(index = 0; index < u8NumSample; index++)
     {
-        err = sht40x_get_temp_rh(&sht40x_handler, precision, pData);
-		{
-			return err;   /**< return error status*/
-		}
-        sht40x_interface_delay_ms(100);              /**< wait 100 ms between each sample measurement */
-        temp_C_Samples += pData->temperature_C;
-        temp_F_Samples += pData->temperature_F;
-        humiditySamples += pData->humidity;
+        err = sht40x_read_ticks(pHandle, precision, &ticks);       /**< back to back, spaced by the conversion time only */
+        if(err)
+        {
+            return err;   /**< return error status*/
+        }
+        memset(&sample, 0, sizeof(sample));
+        sample.temperature = ticks.temperature;
+        sample.humidity = ticks.humidity;
+        err = sht40x_filter_push(&average, &sample, &result);
     }
 
-    pData->temperature_C = (float)(temp_C_Samples / u8NumSample);
-    pData->temperature_F = (float)(temp_F_Samples / u8NumSample);
-    pData->humidity = (float)(humiditySamples / u8NumSample);
+    if(err)
+    {
+        return 1;   /**< no average produced */
+    }
 
-     return 0;   /**< success*/
+    return sht40x_convert_ticks(result.temperature, result.humidity, pData);   /**< average computed on raw ticks */
 }
 
 /**
  * @brief     Basic implementation to get the device serial number
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pSerial_Number point to the device serial number
  * @return  status code
  *            - 0 success
  *            - 1 failed to get S/N
  * @note      none
  */
-uint8_t sht40x_basic_get_serial_number(uint32_t *pSerial_Number)
+uint8_t sht40x_basic_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSerial_Number)
 {
   int err;
-  err = sht40x_get_serial_number(&sht40x_handler, (uint32_t *)pSerial_Number);
+  err = sht40x_get_serial_number(pHandle, (uint32_t *)pSerial_Number);
   return err;   /**< return error status*/
 }
 
 
 /**
  * @brief     Basic implementation to activate heater
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in]  power is the heater power desired
  * @param[out] pData point to the sensor data to read
  * @return  status code
@@ -168,39 +256,74 @@ uint8_t sht40x_basic_get_serial_number(uint32_t *pSerial_Number)
  *            - 1 failed activate heater
  * @note      none
  */
-uint8_t sht40x_basic_activate_heater(sht40x_heater_power_t power, sht40x_data_t *pData)
+uint8_t sht40x_basic_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power, sht40x_data_t *pData)
+{
+    int err;
+    err = sht40x_activate_heater(pHandle, power, pData);
+    return err;   /**< return error status*/
+}
+
+/**
+ * @brief     Basic implementation to start a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in]  power is the heater power desired
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to start heater
+ * @note      does not wait for the pulse, see sht40x_basic_fetch_heater
+ */
+uint8_t sht40x_basic_start_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power)
+{
+    int err;
+    err = sht40x_start_heater(pHandle, power);
+    return err;   /**< return error status*/
+}
+
+/**
+ * @brief     Basic implementation to fetch the measurement taken at the end of a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to read
+ *            - 4 heater pulse still running
+ * @note      none
+ */
+uint8_t sht40x_basic_fetch_heater(sht40x_handle_t *const pHandle, sht40x_data_t *pData)
 {
     int err;
-    err = sht40x_activate_heater(&sht40x_handler, power, pData);
+    err = sht40x_fetch_heater(pHandle, pData);
     return err;   /**< return error status*/
 }
 
 /**
  * @brief   Basic implementation to soft reset the device
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @return  status code
  *            - 0 success
  *            - 1 failed to reset
  * @note      none
  */
-uint8_t sht40x_basic_soft_reset(void)
+uint8_t sht40x_basic_soft_reset(sht40x_handle_t *const pHandle)
 {
     int err;
-    err = sht40x_soft_reset(&sht40x_handler);
+    err = sht40x_soft_reset(pHandle);
     return err;   /**< return error status*/
 }
 
 /**
  * @brief    Basic implementation to get the address
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pI2c_address point to the chip i2c address
  * @return  status code
  *            - 0 success
  *            - 1 failed to get i2c address
  * @note      none
  */
-uint8_t sht40x_basic_get_addr(uint8_t  *pI2c_address)
+uint8_t sht40x_basic_get_addr(sht40x_handle_t *const pHandle, uint8_t  *pI2c_address)
 {
     int err;
-	err = sht40x_get_addr(&sht40x_handler, (uint8_t *)pI2c_address);
+	err = sht40x_get_addr(pHandle, (uint8_t *)pI2c_address);
 	return err;   /**< return error status*/
 }
 
@@ -30,28 +30,36 @@
 
 #include "sht40x_driver_interface.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief basic example initialize
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] pBus is the bus context given to the interface i2c functions
  * @param[in] variant is the device type
  * @return status code
  *          - 0 success
  *          - 1 initialize failed
  * @note    none
  */
-uint8_t sht40x_basic_initialize(sht40x_variant_t variant);
+uint8_t sht40x_basic_initialize(sht40x_handle_t *const pHandle, void *pBus, sht40x_variant_t variant);
 
 /**
  * @brief     This function get the device variant
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pVariant point to the device variant
  * @return  status code
  *            - 0 success
  *            - 1 failed to get device variant
  * @note      none
  */
-uint8_t sht40x_basic_get_variant(sht40x_variant_t *pVariant);
+uint8_t sht40x_basic_get_variant(sht40x_handle_t *const pHandle, sht40x_variant_t *pVariant);
 
 /**
  * @brief     Basic implementation to read the temperature and relative humidity
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in] precision is the data read accuracy
  * @param[out] pData point to the sensor data to read
  * @return  status code
@@ -59,33 +67,86 @@ uint8_t sht40x_basic_get_variant(sht40x_variant_t *pVariant);
  *            - 1 failed to get temp/humidity
  * @note      none
  */
-uint8_t sht40x_basic_get_temp_rh(sht40x_precision_t precision, sht40x_data_t *pData);
+uint8_t sht40x_basic_get_temp_rh(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_data_t *pData);
+
+/**
+ * @brief     Basic implementation to start a temperature and relative humidity measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to start measurement
+ * @note      does not wait for the conversion, see sht40x_basic_fetch_measurement
+ */
+uint8_t sht40x_basic_start_measurement(sht40x_handle_t *const pHandle, sht40x_precision_t precision);
+
+/**
+ * @brief     Basic implementation to fetch a measurement started with sht40x_basic_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 4 measurement not ready yet
+ * @note      none
+ */
+uint8_t sht40x_basic_fetch_measurement(sht40x_handle_t *const pHandle, sht40x_data_t *pData);
+
+/**
+ * @brief     Basic implementation to read the raw temperature and relative humidity ticks
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in] precision is the data read accuracy
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 5 CRC mismatch
+ * @note      no conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_basic_read_ticks(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_ticks_t *pTicks);
+
+/**
+ * @brief     Basic implementation to fetch the raw ticks of a measurement started with sht40x_basic_start_measurement
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pTicks point to the raw ticks to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to get temp/humidity
+ *            - 4 measurement not ready yet
+ *            - 5 CRC mismatch
+ * @note      no conversion, see sht40x_convert_batch
+ */
+uint8_t sht40x_basic_fetch_ticks(sht40x_handle_t *const pHandle, sht40x_ticks_t *pTicks);
 
 /**
  * @brief     Basic implementation to read the temperature and relative humidity with n number of samples
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in] precision is the data read accuracy
  * @param[out] pData point to the sensor data to read
  * @param[in] u8NumSample is the number of samples to read
  * @return  status code
  *            - 0 success
  *            - 1 failed to get temp/humidity
- * @note      none
+ * @note      samples are taken back to back and averaged on raw ticks, see sht40x_driver_filter.h
+ *            for a non-blocking version fed by the sampler
  */
-uint8_t sht40x_basic_get_temp_humidity_nSample(sht40x_precision_t precision, sht40x_data_t *pData, uint8_t u8NumSample);
+uint8_t sht40x_basic_get_temp_humidity_nSample(sht40x_handle_t *const pHandle, sht40x_precision_t precision, sht40x_data_t *pData, uint8_t u8NumSample);
 
 /**
  * @brief     Basic implementation to get the device serial number
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pSerial_Number point to the device serial number
  * @return  status code
  *            - 0 success
  *            - 1 failed to get S/N
  * @note      none
  */
-uint8_t sht40x_basic_get_serial_number(uint32_t *pSerial_Number);
+uint8_t sht40x_basic_get_serial_number(sht40x_handle_t *const pHandle, uint32_t *pSerial_Number);
 
 
 /**
  * @brief     Basic implementation to activate heater
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[in]  power is the heater power desired
  * @param[out] pData point to the sensor data to read
  * @return  status code
@@ -93,26 +154,55 @@ uint8_t sht40x_basic_get_serial_number(uint32_t *pSerial_Number);
  *            - 1 failed activate heater
  * @note      none
  */
-uint8_t sht40x_basic_activate_heater(sht40x_heater_power_t power, sht40x_data_t *pData);
+uint8_t sht40x_basic_activate_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power, sht40x_data_t *pData);
+
+/**
+ * @brief     Basic implementation to start a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[in]  power is the heater power desired
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to start heater
+ * @note      does not wait for the pulse, see sht40x_basic_fetch_heater
+ */
+uint8_t sht40x_basic_start_heater(sht40x_handle_t *const pHandle, sht40x_heater_power_t power);
+
+/**
+ * @brief     Basic implementation to fetch the measurement taken at the end of a heater pulse
+ * @param[in] *pHandle points to sht40x pHandle structure
+ * @param[out] pData point to the sensor data to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 failed to read
+ *            - 4 heater pulse still running
+ * @note      none
+ */
+uint8_t sht40x_basic_fetch_heater(sht40x_handle_t *const pHandle, sht40x_data_t *pData);
 
 /**
  * @brief   Basic implementation to soft reset the device
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @return  status code
  *            - 0 success
  *            - 1 failed to reset
  * @note      none
  */
-uint8_t sht40x_basic_soft_reset(void);
+uint8_t sht40x_basic_soft_reset(sht40x_handle_t *const pHandle);
 
 /**
  * @brief    Basic implementation to get the address
+ * @param[in] *pHandle points to sht40x pHandle structure
  * @param[out] pI2c_address point to the chip i2c address
  * @return  status code
  *            - 0 success
  *            - 1 failed to get i2c address
  * @note      none
  */
-uint8_t sht40x_basic_get_addr(uint8_t  *pI2c_address);
+uint8_t sht40x_basic_get_addr(sht40x_handle_t *const pHandle, uint8_t  *pI2c_address);
+
 
+#ifdef __cplusplus
+}
+#endif
 
 #endif // SHT40X_DRIVER_BASIC_H_INCLUDED
@@ -0,0 +1,99 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_clock.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 03:10 PM
+ */
+
+#include "sht40x_driver_clock.h"
+
+/**
+ * @brief     This function initializes a virtual clock
+ * @param[in] *pClock points to the clock structure
+ * @param[in] u64Start_us is the initial time in microseconds
+ * @return  status code
+ *            - 0 success
+ *            - 2 pClock is NULL
+ * @note      start close to 2^32 ms to exercise tick wrap around
+ */
+uint8_t sht40x_vclock_init(sht40x_vclock_t *const pClock, uint64_t u64Start_us)
+{
+    if(pClock == NULL)
+        return 2;     /**< return failed error */
+
+    pClock->now_us = u64Start_us;
+    pClock->slept_us = 0;
+    pClock->delays = 0;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function moves a virtual clock forward
+ * @param[in] *pClock points to the clock structure
+ * @param[in] u32Us is the time to add in microseconds
+ * @return    none
+ * @note      use it to step a scheduler between calls, not accounted as a delay
+ */
+void sht40x_vclock_advance_us(sht40x_vclock_t *const pClock, uint32_t u32Us)
+{
+    pClock->now_us += u32Us;
+}
+
+/**
+ * @brief     virtual clock now, matches the handle clock_now_ms signature
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @return    time in milliseconds, wraps around like a hardware tick
+ * @note      none
+ */
+uint32_t sht40x_vclock_now_ms(void *pClock)
+{
+    return (uint32_t)(((sht40x_vclock_t *)pClock)->now_us / 1000ULL);
+}
+
+/**
+ * @brief     virtual clock now in microseconds, matches the virtual device now_us hook
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @return    time in microseconds
+ * @note      none
+ */
+uint64_t sht40x_vclock_now_us(void *pClock)
+{
+    return ((sht40x_vclock_t *)pClock)->now_us;
+}
+
+/**
+ * @brief     virtual clock delay, matches the handle clock_delay_ms signature
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @param[in] u32Ms is the time in milliseconds
+ * @return    none
+ * @note      returns at once after moving the time forward
+ */
+void sht40x_vclock_delay_ms(void *pClock, uint32_t u32Ms)
+{
+    sht40x_vclock_t *pVirtual = (sht40x_vclock_t *)pClock;
+
+    pVirtual->now_us += (uint64_t)u32Ms * 1000ULL;
+    pVirtual->slept_us += (uint64_t)u32Ms * 1000ULL;
+    pVirtual->delays++;
+}
@@ -0,0 +1,100 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_clock.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 03:10 PM
+ */
+
+#ifndef SHT40X_DRIVER_CLOCK_H_INCLUDED
+#define SHT40X_DRIVER_CLOCK_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_clock_driver sht40x virtual clock function
+ * @brief    deterministic clock for DRIVER_SHT40X_LINK_CLOCK, every delay returns at once
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+* @brief sht40x virtual clock structure definition
+* @note  time only moves through delays and sht40x_vclock_advance_us, runs are exactly repeatable
+*/
+typedef struct sht40x_vclock_s
+{
+    uint64_t now_us;                                                  /**< current simulated time */
+    uint64_t slept_us;                                                /**< simulated time spent in delays */
+    uint32_t delays;                                                  /**< delay calls */
+} sht40x_vclock_t;
+
+/**
+ * @brief     This function initializes a virtual clock
+ * @param[in] *pClock points to the clock structure
+ * @param[in] u64Start_us is the initial time in microseconds
+ * @return  status code
+ *            - 0 success
+ *            - 2 pClock is NULL
+ * @note      start close to 2^32 ms to exercise tick wrap around
+ */
+uint8_t sht40x_vclock_init(sht40x_vclock_t *const pClock, uint64_t u64Start_us);
+
+/**
+ * @brief     This function moves a virtual clock forward
+ * @param[in] *pClock points to the clock structure
+ * @param[in] u32Us is the time to add in microseconds
+ * @return    none
+ * @note      use it to step a scheduler between calls, not accounted as a delay
+ */
+void sht40x_vclock_advance_us(sht40x_vclock_t *const pClock, uint32_t u32Us);
+
+/**
+ * @brief     virtual clock now, matches the handle clock_now_ms signature
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @return    time in milliseconds, wraps around like a hardware tick
+ * @note      none
+ */
+uint32_t sht40x_vclock_now_ms(void *pClock);
+
+/**
+ * @brief     virtual clock now in microseconds, matches the virtual device now_us hook
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @return    time in microseconds
+ * @note      none
+ */
+uint64_t sht40x_vclock_now_us(void *pClock);
+
+/**
+ * @brief     virtual clock delay, matches the handle clock_delay_ms signature
+ * @param[in] pClock points to a sht40x_vclock_t
+ * @param[in] u32Ms is the time in milliseconds
+ * @return    none
+ * @note      returns at once after moving the time forward
+ */
+void sht40x_vclock_delay_ms(void *pClock, uint32_t u32Ms);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_CLOCK_H_INCLUDED
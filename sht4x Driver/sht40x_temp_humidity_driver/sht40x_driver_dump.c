@@ -0,0 +1,162 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_dump.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 PM
+ */
+
+#include "sht40x_driver_dump.h"
+
+/**
+ * @brief     This function stores a little endian 16 bit value
+ * @param[out] *pBuf points to 2 bytes
+ * @param[in] u16Value is the value to store
+ * @return    none
+ * @note      none
+ */
+void sht40x_dump_put16(uint8_t *pBuf, uint16_t u16Value)
+{
+    pBuf[0] = (uint8_t)u16Value;
+    pBuf[1] = (uint8_t)(u16Value >> 8);
+}
+
+/**
+ * @brief     This function stores a little endian 32 bit value
+ * @param[out] *pBuf points to 4 bytes
+ * @param[in] u32Value is the value to store
+ * @return    none
+ * @note      none
+ */
+void sht40x_dump_put32(uint8_t *pBuf, uint32_t u32Value)
+{
+    sht40x_dump_put16(&pBuf[0], (uint16_t)u32Value);
+    sht40x_dump_put16(&pBuf[2], (uint16_t)(u32Value >> 16));
+}
+
+/**
+ * @brief     This function initializes an empty ring
+ * @param[in] *pRing points to the ring structure
+ * @param[in] u16Size is the number of entries, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ * @note      none
+ */
+uint8_t sht40x_dump_ring_init(sht40x_dump_ring_t *const pRing, uint16_t u16Size)
+{
+    if((u16Size == 0) || ((u16Size & (u16Size - 1U)) != 0))
+        return 1;     /**< size must be a power of two */
+
+    pRing->mask = (uint16_t)(u16Size - 1U);
+    pRing->head = 0;
+    pRing->total = 0;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function claims the slot of the next entry
+ * @param[in] *pRing points to the ring structure
+ * @return    storage index to fill, the oldest entry when the ring is full
+ * @note      the entry counts as recorded from this call on
+ */
+uint16_t sht40x_dump_ring_next(sht40x_dump_ring_t *const pRing)
+{
+    uint16_t u16Slot = pRing->head & pRing->mask;
+
+    pRing->head++;
+    pRing->total++;
+
+    return u16Slot;
+}
+
+/**
+ * @brief     This function returns the number of entries held
+ * @param[in] *pRing points to the ring structure
+ * @return    entries held, at most the ring size
+ * @note      none
+ */
+uint16_t sht40x_dump_ring_count(const sht40x_dump_ring_t *const pRing)
+{
+    if(pRing->total > pRing->mask)
+    {
+        return (uint16_t)(pRing->mask + 1U);
+    }
+    return (uint16_t)pRing->total;
+}
+
+/**
+ * @brief     This function finds an entry, oldest first
+ * @param[in] *pRing points to the ring structure
+ * @param[in] u16Index is 0 for the oldest entry held
+ * @param[out] *pSlot points to the storage index of the entry
+ * @return  status code
+ *            - 0 success
+ *            - 1 index out of range
+ * @note      none
+ */
+uint8_t sht40x_dump_ring_slot(const sht40x_dump_ring_t *const pRing, uint16_t u16Index, uint16_t *pSlot)
+{
+    uint16_t u16Count = sht40x_dump_ring_count(pRing);
+
+    if(u16Index >= u16Count)
+        return 1;     /**< nothing recorded there */
+
+    *pSlot = (uint16_t)(pRing->head - u16Count + u16Index) & pRing->mask;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function serializes a ring
+ * @param[in] *pRing points to the ring structure
+ * @param[in] *pMagic points to the SHT40X_DUMP_MAGIC_SIZE byte format magic
+ * @param[in] u8EntrySize is the size of one serialized entry, at most SHT40X_DUMP_ENTRY_MAX
+ * @param[in] serialize fills pBuf with the entry stored at u16Slot of pEntries
+ * @param[in] *pEntries is passed to serialize
+ * @param[in] output is called with consecutive chunks of the dump
+ * @param[in] *pContext is passed to output
+ * @return    none
+ * @note      16 byte header (magic, entry size, entry count, lost entries) then the entries oldest
+ *            first, little endian
+ */
+void sht40x_dump_ring_write(const sht40x_dump_ring_t *const pRing, const char *pMagic, uint8_t u8EntrySize,
+                            void (*serialize)(const void *pEntries, uint16_t u16Slot, uint8_t *pBuf), const void *pEntries,
+                            void (*output)(void *pContext, const uint8_t *pBuf, uint8_t u8Length), void *pContext)
+{
+    uint8_t pBuf[SHT40X_DUMP_ENTRY_MAX];
+    uint16_t u16Count = sht40x_dump_ring_count(pRing);
+    uint16_t index;
+
+    memcpy(pBuf, pMagic, SHT40X_DUMP_MAGIC_SIZE);
+    sht40x_dump_put16(&pBuf[8], u8EntrySize);
+    sht40x_dump_put16(&pBuf[10], u16Count);
+    sht40x_dump_put32(&pBuf[12], pRing->total - u16Count);
+    output(pContext, pBuf, SHT40X_DUMP_HEADER_SIZE);
+
+    for(index = 0; index < u16Count; index++)
+    {
+        serialize(pEntries, (uint16_t)(pRing->head - u16Count + index) & pRing->mask, pBuf);
+        output(pContext, pBuf, u8EntrySize);
+    }
+}
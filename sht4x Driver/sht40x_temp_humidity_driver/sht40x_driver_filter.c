@@ -0,0 +1,210 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_filter.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 AM
+ */
+
+#include "sht40x_driver_filter.h"
+
+/**
+* @brief This function returns the median of a small window
+* @param[in] *pWindow point to the window values
+* @param[in] u8Length is the window length
+* @return median value
+* @note   insertion sort on a copy, the window holds at most SHT40X_FILTER_MEDIAN_MAX values
+*/
+static uint16_t a_sht40x_filter_median(const uint16_t *pWindow, uint8_t u8Length)
+{
+    uint16_t pSorted[SHT40X_FILTER_MEDIAN_MAX];
+    uint16_t u16Value;
+    uint8_t i, j;
+
+    for(i = 0; i < u8Length; i++)
+    {
+        u16Value = pWindow[i];
+        for(j = i; (j > 0) && (pSorted[j - 1] > u16Value); j--)
+        {
+            pSorted[j] = pSorted[j - 1];
+        }
+        pSorted[j] = u16Value;
+    }
+
+    return pSorted[u8Length / 2];
+}
+
+/**
+ * @brief     This function initializes a streaming filter
+ * @param[in] *pFilter points to the filter structure
+ * @param[in] type is the filter type
+ * @param[in] u8Length is the boxcar length (1..255), the median window (1..9, odd) or the EMA shift (1..8)
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid type or length
+ *            - 2 pFilter is NULL
+ * @note      none
+ */
+uint8_t sht40x_filter_init(sht40x_filter_t *const pFilter, sht40x_filter_type_t type, uint8_t u8Length)
+{
+    if(pFilter == NULL)
+        return 2;     /**< return failed error */
+
+    switch(type)
+    {
+        case SHT40X_FILTER_BOXCAR:
+        {
+            if(u8Length == 0)
+                return 1;
+            break;
+        }
+
+        case SHT40X_FILTER_EMA:
+        {
+            if((u8Length == 0) || (u8Length > SHT40X_FILTER_EMA_SHIFT_MAX))
+                return 1;
+            break;
+        }
+
+        case SHT40X_FILTER_MEDIAN:
+        {
+            if((u8Length == 0) || (u8Length > SHT40X_FILTER_MEDIAN_MAX) || ((u8Length & 1) == 0))
+                return 1;
+            break;
+        }
+
+        default:
+        {
+            return 1;       /**< unknown filter */
+        }
+    }
+
+    memset(pFilter, 0, sizeof(sht40x_filter_t));
+    pFilter->type = type;
+    pFilter->length = u8Length;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function clears the filter history
+ * @param[in] *pFilter points to the filter structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pFilter is NULL
+ * @note      none
+ */
+uint8_t sht40x_filter_reset(sht40x_filter_t *const pFilter)
+{
+    if(pFilter == NULL)
+        return 2;     /**< return failed error */
+
+    pFilter->count = 0;
+    pFilter->index = 0;
+    pFilter->sum_temperature = 0;
+    pFilter->sum_humidity = 0;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function feeds one sample to the filter
+ * @param[in] *pFilter points to the filter structure
+ * @param[in] *pIn points to the new sample
+ * @param[out] *pOut points to the filtered sample, written when status is 0
+ * @return  status code
+ *            - 0 success, pOut holds a filtered sample
+ *            - 1 filter not initialized
+ *            - 2 a pointer is NULL
+ *            - 4 no output for this input yet (boxcar block or median window not full)
+ * @note      constant time, never blocks. The output carries the newest input delta and flags.
+ */
+uint8_t sht40x_filter_push(sht40x_filter_t *const pFilter, const sht40x_sample_t *pIn, sht40x_sample_t *pOut)
+{
+    int32_t s32Delta;
+
+    if((pFilter == NULL) || (pIn == NULL) || (pOut == NULL))
+        return 2;     /**< return failed error */
+
+    *pOut = *pIn;       /**< optional time fields follow the newest input */
+
+    switch(pFilter->type)
+    {
+        case SHT40X_FILTER_BOXCAR:
+        {
+            pFilter->sum_temperature += pIn->temperature;
+            pFilter->sum_humidity += pIn->humidity;
+            if(++pFilter->count < pFilter->length)
+                return SHT40X_DRV_NOT_READY;       /**< block not complete */
+
+            pOut->temperature = (uint16_t)((pFilter->sum_temperature + (pFilter->length / 2)) / pFilter->length);
+            pOut->humidity = (uint16_t)((pFilter->sum_humidity + (pFilter->length / 2)) / pFilter->length);
+            pFilter->sum_temperature = 0;
+            pFilter->sum_humidity = 0;
+            pFilter->count = 0;
+            return 0;
+        }
+
+        case SHT40X_FILTER_EMA:
+        {
+            if(pFilter->count == 0)
+            {
+                pFilter->sum_temperature = (uint32_t)pIn->temperature << SHT40X_FILTER_EMA_FRACTION;     /**< seed with the first sample */
+                pFilter->sum_humidity = (uint32_t)pIn->humidity << SHT40X_FILTER_EMA_FRACTION;
+                pFilter->count = 1;
+            }
+            else
+            {
+                s32Delta = (int32_t)((uint32_t)pIn->temperature << SHT40X_FILTER_EMA_FRACTION) - (int32_t)pFilter->sum_temperature;
+                pFilter->sum_temperature = (uint32_t)((int32_t)pFilter->sum_temperature + (s32Delta >> pFilter->length));
+                s32Delta = (int32_t)((uint32_t)pIn->humidity << SHT40X_FILTER_EMA_FRACTION) - (int32_t)pFilter->sum_humidity;
+                pFilter->sum_humidity = (uint32_t)((int32_t)pFilter->sum_humidity + (s32Delta >> pFilter->length));
+            }
+            pOut->temperature = (uint16_t)((pFilter->sum_temperature + (1UL << (SHT40X_FILTER_EMA_FRACTION - 1))) >> SHT40X_FILTER_EMA_FRACTION);
+            pOut->humidity = (uint16_t)((pFilter->sum_humidity + (1UL << (SHT40X_FILTER_EMA_FRACTION - 1))) >> SHT40X_FILTER_EMA_FRACTION);
+            return 0;
+        }
+
+        case SHT40X_FILTER_MEDIAN:
+        {
+            pFilter->window_temperature[pFilter->index] = pIn->temperature;
+            pFilter->window_humidity[pFilter->index] = pIn->humidity;
+            pFilter->index = (pFilter->index + 1 == pFilter->length) ? 0 : pFilter->index + 1;
+            if(pFilter->count < pFilter->length)
+            {
+                if(++pFilter->count < pFilter->length)
+                    return SHT40X_DRV_NOT_READY;   /**< window not full */
+            }
+
+            pOut->temperature = a_sht40x_filter_median(pFilter->window_temperature, pFilter->length);
+            pOut->humidity = a_sht40x_filter_median(pFilter->window_humidity, pFilter->length);
+            return 0;
+        }
+
+        default:
+        {
+            return 1;       /**< not initialized */
+        }
+    }
+}
+
+/* end */
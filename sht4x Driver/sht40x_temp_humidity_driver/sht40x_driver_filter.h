@@ -0,0 +1,110 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_filter.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 AM
+ */
+
+#ifndef SHT40X_DRIVER_FILTER_H_INCLUDED
+#define SHT40X_DRIVER_FILTER_H_INCLUDED
+
+#include "sht40x_driver_sampler.h"
+
+/**
+ * @defgroup sht40x_filter_driver sht40x streaming filter function
+ * @brief    sht40x streaming filter modules, integer math on raw ticks
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_FILTER_MEDIAN_MAX                    9U                  /**< largest median window */
+#define SHT40X_FILTER_EMA_SHIFT_MAX                 8U                  /**< smallest EMA weight is 1/256 */
+#define SHT40X_FILTER_EMA_FRACTION                  8U                  /**< fractional bits kept in the EMA state */
+
+ /**
+ * @brief sht40x filter type enumeration
+ */
+typedef enum
+{
+    SHT40X_FILTER_BOXCAR = 0x00,                                      /**< average of N samples, one output every N inputs */
+    SHT40X_FILTER_EMA    = 0x01,                                      /**< exponential moving average, weight 1/2^N, one output per input */
+    SHT40X_FILTER_MEDIAN = 0x02                                       /**< median of the last N samples, one output per input */
+} sht40x_filter_type_t;
+
+/**
+* @brief sht40x streaming filter structure definition
+*/
+typedef struct sht40x_filter_s
+{
+    uint8_t type;                                                     /**< sht40x_filter_type_t */
+    uint8_t length;                                                   /**< boxcar / median length or EMA shift */
+    uint8_t count;                                                    /**< samples accumulated so far */
+    uint8_t index;                                                    /**< next median window slot */
+    uint32_t sum_temperature;                                         /**< boxcar temperature sum, EMA temperature state */
+    uint32_t sum_humidity;                                            /**< boxcar humidity sum, EMA humidity state */
+    uint16_t window_temperature[SHT40X_FILTER_MEDIAN_MAX];            /**< median temperature window */
+    uint16_t window_humidity[SHT40X_FILTER_MEDIAN_MAX];               /**< median humidity window */
+} sht40x_filter_t;
+
+/**
+ * @brief     This function initializes a streaming filter
+ * @param[in] *pFilter points to the filter structure
+ * @param[in] type is the filter type
+ * @param[in] u8Length is the boxcar length (1..255), the median window (1..9, odd) or the EMA shift (1..8)
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid type or length
+ *            - 2 pFilter is NULL
+ * @note      none
+ */
+uint8_t sht40x_filter_init(sht40x_filter_t *const pFilter, sht40x_filter_type_t type, uint8_t u8Length);
+
+/**
+ * @brief     This function clears the filter history
+ * @param[in] *pFilter points to the filter structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pFilter is NULL
+ * @note      none
+ */
+uint8_t sht40x_filter_reset(sht40x_filter_t *const pFilter);
+
+/**
+ * @brief     This function feeds one sample to the filter
+ * @param[in] *pFilter points to the filter structure
+ * @param[in] *pIn points to the new sample
+ * @param[out] *pOut points to the filtered sample, written when status is 0
+ * @return  status code
+ *            - 0 success, pOut holds a filtered sample
+ *            - 1 filter not initialized
+ *            - 2 a pointer is NULL
+ *            - 4 no output for this input yet (boxcar block or median window not full)
+ * @note      constant time, never blocks. The output carries the newest input delta and flags.
+ */
+uint8_t sht40x_filter_push(sht40x_filter_t *const pFilter, const sht40x_sample_t *pIn, sht40x_sample_t *pOut);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_FILTER_H_INCLUDED
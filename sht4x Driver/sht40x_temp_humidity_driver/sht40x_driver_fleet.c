@@ -0,0 +1,171 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_fleet.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 08:10 PM
+ */
+
+#include "sht40x_driver_fleet.h"
+
+/**
+* @brief This function finds where a serial belongs in the table
+* @param[in] *pFleet points to the fleet structure
+* @param[in] u32Serial is the serial number
+* @return index of the first entry whose serial is not lower
+* @note none
+*/
+static uint16_t a_sht40x_fleet_lower_bound(const sht40x_fleet_t *const pFleet, uint32_t u32Serial)
+{
+    uint16_t u16Low = 0;
+    uint16_t u16High = pFleet->count;
+
+    while(u16Low < u16High)
+    {
+        uint16_t u16Mid = (uint16_t)((u16Low + u16High) >> 1);
+
+        if(pFleet->pTable[u16Mid].serial < u32Serial)
+            u16Low = u16Mid + 1;
+        else
+            u16High = u16Mid;
+    }
+    return u16Low;
+}
+
+/**
+ * @brief     This function initializes an empty fleet
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] *pHandles points to u16Size handles
+ * @param[in] *pTable points to u16Size table entries
+ * @param[in] u16Size is the capacity
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      none
+ */
+uint8_t sht40x_fleet_init(sht40x_fleet_t *const pFleet, sht40x_handle_t *pHandles, sht40x_fleet_entry_t *pTable, uint16_t u16Size)
+{
+    if((pFleet == NULL) || (pHandles == NULL) || (pTable == NULL))
+        return 2;
+
+    memset(pFleet, 0, sizeof(sht40x_fleet_t));
+    pFleet->pHandles = pHandles;
+    pFleet->pTable = pTable;
+    pFleet->size = u16Size;
+
+    return 0;
+}
+
+/**
+ * @brief     This function probes every address on every bus and records the sensors that answer
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] *pTemplate points to a handle with the i2c, delay and debug functions linked, not initialized
+ * @param[in] *pBuses is an array of u8BusCount bus pointers, given to the handles as i2c_bus
+ * @param[in] u8BusCount is the number of buses
+ * @param[in] *pVariants is an array of u8VariantCount variants, one per address to probe
+ * @param[in] u8VariantCount is the number of variants
+ * @return  status code
+ *            - 0 success
+ *            - 1 the table is full, enumeration stopped early
+ *            - 2 a pointer is NULL
+ * @note      each serial is read once and stays cached in its handle. Handles of the devices that do
+ *            not answer are deinitialized, found handles stay initialized. Appends to a previous run.
+ */
+uint8_t sht40x_fleet_enumerate(sht40x_fleet_t *const pFleet, const sht40x_handle_t *pTemplate, void *const pBuses[], uint8_t u8BusCount,
+                               const sht40x_variant_t *pVariants, uint8_t u8VariantCount)
+{
+    uint8_t u8Bus;
+    uint8_t u8Variant;
+    uint16_t u16Slot;
+    uint32_t u32Serial;
+    sht40x_handle_t *pHandle;
+
+    if((pFleet == NULL) || (pTemplate == NULL) || (pBuses == NULL) || (pVariants == NULL))
+        return 2;
+
+    for(u8Bus = 0; u8Bus < u8BusCount; u8Bus++)
+    {
+        for(u8Variant = 0; u8Variant < u8VariantCount; u8Variant++)
+        {
+            if(pFleet->count >= pFleet->size)
+                return 1;       /**< no room for another handle */
+
+            pHandle = &pFleet->pHandles[pFleet->count];
+            *pHandle = *pTemplate;
+            pHandle->i2c_bus = pBuses[u8Bus];
+            pHandle->inited = 0;
+            pFleet->probes++;
+
+            if(sht40x_init(pHandle) != SHT40X_DRV_OK)
+                continue;
+            if((sht40x_set_variant(pHandle, pVariants[u8Variant]) != SHT40X_DRV_OK) ||
+               (sht40x_set_addr(pHandle) != SHT40X_DRV_OK) ||
+               (sht40x_get_serial_number(pHandle, &u32Serial) != SHT40X_DRV_OK))
+            {
+                (void)sht40x_deinit(pHandle);
+                continue;       /**< nobody at this address */
+            }
+
+            u16Slot = a_sht40x_fleet_lower_bound(pFleet, u32Serial);
+            if((u16Slot < pFleet->count) && (pFleet->pTable[u16Slot].serial == u32Serial))
+            {
+                pFleet->duplicates++;           /**< same device reached twice, through a mux or a bridged bus */
+                (void)sht40x_deinit(pHandle);
+                continue;
+            }
+
+            memmove(&pFleet->pTable[u16Slot + 1], &pFleet->pTable[u16Slot], (size_t)(pFleet->count - u16Slot) * sizeof(sht40x_fleet_entry_t));
+            pFleet->pTable[u16Slot].serial = u32Serial;
+            pFleet->pTable[u16Slot].pHandle = pHandle;
+            pFleet->count++;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     This function looks up a sensor by serial number
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] u32Serial is the serial number
+ * @param[out] **ppHandle points to the handle found
+ * @return  status code
+ *            - 0 success
+ *            - 1 serial not in the fleet
+ *            - 2 a pointer is NULL
+ * @note      binary search
+ */
+uint8_t sht40x_fleet_find(const sht40x_fleet_t *const pFleet, uint32_t u32Serial, sht40x_handle_t **ppHandle)
+{
+    uint16_t u16Slot;
+
+    if((pFleet == NULL) || (ppHandle == NULL))
+        return 2;
+
+    u16Slot = a_sht40x_fleet_lower_bound(pFleet, u32Serial);
+    if((u16Slot >= pFleet->count) || (pFleet->pTable[u16Slot].serial != u32Serial))
+        return 1;
+
+    *ppHandle = pFleet->pTable[u16Slot].pHandle;
+
+    return 0;
+}
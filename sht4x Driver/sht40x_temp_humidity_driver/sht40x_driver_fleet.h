@@ -0,0 +1,110 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_fleet.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 08:10 PM
+ */
+
+#ifndef SHT40X_DRIVER_FLEET_H_INCLUDED
+#define SHT40X_DRIVER_FLEET_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_fleet_driver sht40x fleet enumeration function
+ * @brief    finds the sensors on a set of buses and indexes them by serial number
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+* @brief sht40x fleet table entry structure definition
+*/
+typedef struct sht40x_fleet_entry_s
+{
+    uint32_t serial;                                                  /**< device serial number */
+    sht40x_handle_t *pHandle;                                         /**< initialized handle of the device */
+} sht40x_fleet_entry_t;
+
+/**
+* @brief sht40x fleet structure definition
+*/
+typedef struct sht40x_fleet_s
+{
+    sht40x_handle_t *pHandles;                                        /**< caller provided storage, one handle per sensor found */
+    sht40x_fleet_entry_t *pTable;                                     /**< caller provided storage, sorted by serial */
+    uint16_t size;                                                    /**< capacity of pHandles and pTable */
+    uint16_t count;                                                   /**< sensors found */
+    uint16_t probes;                                                  /**< bus / address pairs probed */
+    uint16_t duplicates;                                              /**< serials answered twice, the later probes are dropped */
+} sht40x_fleet_t;
+
+/**
+ * @brief     This function initializes an empty fleet
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] *pHandles points to u16Size handles
+ * @param[in] *pTable points to u16Size table entries
+ * @param[in] u16Size is the capacity
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      none
+ */
+uint8_t sht40x_fleet_init(sht40x_fleet_t *const pFleet, sht40x_handle_t *pHandles, sht40x_fleet_entry_t *pTable, uint16_t u16Size);
+
+/**
+ * @brief     This function probes every address on every bus and records the sensors that answer
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] *pTemplate points to a handle with the i2c, delay and debug functions linked, not initialized
+ * @param[in] *pBuses is an array of u8BusCount bus pointers, given to the handles as i2c_bus
+ * @param[in] u8BusCount is the number of buses
+ * @param[in] *pVariants is an array of u8VariantCount variants, one per address to probe
+ * @param[in] u8VariantCount is the number of variants
+ * @return  status code
+ *            - 0 success
+ *            - 1 the table is full, enumeration stopped early
+ *            - 2 a pointer is NULL
+ * @note      each serial is read once and stays cached in its handle. Handles of the devices that do
+ *            not answer are deinitialized, found handles stay initialized. Appends to a previous run.
+ */
+uint8_t sht40x_fleet_enumerate(sht40x_fleet_t *const pFleet, const sht40x_handle_t *pTemplate, void *const pBuses[], uint8_t u8BusCount,
+                               const sht40x_variant_t *pVariants, uint8_t u8VariantCount);
+
+/**
+ * @brief     This function looks up a sensor by serial number
+ * @param[in] *pFleet points to the fleet structure
+ * @param[in] u32Serial is the serial number
+ * @param[out] **ppHandle points to the handle found
+ * @return  status code
+ *            - 0 success
+ *            - 1 serial not in the fleet
+ *            - 2 a pointer is NULL
+ * @note      binary search
+ */
+uint8_t sht40x_fleet_find(const sht40x_fleet_t *const pFleet, uint32_t u32Serial, sht40x_handle_t **ppHandle);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_FLEET_H_INCLUDED
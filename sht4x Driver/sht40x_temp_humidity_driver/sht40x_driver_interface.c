@@ -30,12 +30,13 @@
 
 /**
 * @brief  interface i2c bus init
+* @param[in]  pBus is the bus context linked to the handle
 * @return status code
 *         - 0 success
 *         - 1 i2c init failed
 * @note   none
 */
-uint8_t sht40x_interface_i2c_init(void)
+uint8_t sht40x_interface_i2c_init(void *pBus)
 {
     /*call your i2c initialize function here*/
     /*user code begin */
@@ -46,11 +47,12 @@ uint8_t sht40x_interface_i2c_init(void)
 
 /**
  * @brief interface i2c bus de-init
+ * @param[in]  pBus is the bus context linked to the handle
  * @return status code
  *          - 0 success
  *          - 1 i2c de-init fail
  */
-uint8_t sht40x_interface_i2c_deinit(void)
+uint8_t sht40x_interface_i2c_deinit(void *pBus)
 {
     /*call your i2c de-initialize function here*/
     /*user code begin */
@@ -61,6 +63,7 @@ uint8_t sht40x_interface_i2c_deinit(void)
 
 /**
  * @brief      interface i2c bus read
+ * @param[in]  pBus is the bus context linked to the handle
  * @param[in]  u8Addr is the i2c device address 7 bit
  * @param[out] *pBuf points to a data buffer
  * @param[in]  u8length is the length of the data buffer
@@ -69,7 +72,7 @@ uint8_t sht40x_interface_i2c_deinit(void)
  *             - 1 read failed
  * @note       none
  */
-uint8_t sht40x_interface_i2c_read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+uint8_t sht40x_interface_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
 {
     /*call your i2c read function here*/
     /*user code begin */
@@ -80,6 +83,7 @@ uint8_t sht40x_interface_i2c_read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
 
 /**
  * @brief     interface i2c bus write
+ * @param[in] pBus is the bus context linked to the handle
  * @param[in] u8Addr is the i2c device address 7 bit
  * @param[in] *pBuf points to a data buffer
  * @param[in] u8length is the length of the data buffer
@@ -88,7 +92,7 @@ uint8_t sht40x_interface_i2c_read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
  *            - 1 write failed
  * @note      none
  */
-uint8_t sht40x_interface_i2c_write(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+uint8_t sht40x_interface_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
 {
     /*call your i2c write function here*/
     /*user code begin */
@@ -31,27 +31,28 @@
 
 #include "sht40x_driver.h"
 
-static sht40x_handle_t sht40x_handler;
-
 /**
  * @brief  interface i2c bus init
+ * @param[in]  pBus is the bus context linked to the handle
  * @return status code
  *         - 0 success
  *         - 1 i2c init failed
  * @note   none
  */
-uint8_t sht40x_interface_i2c_init(void);
+uint8_t sht40x_interface_i2c_init(void *pBus);
 
 /**
  * @brief interface i2c bus deinit
+ * @param[in]  pBus is the bus context linked to the handle
  * @return status code
  *          - 0 success
  *          - 1 i2c deinit fail
  */
-uint8_t sht40x_interface_i2c_deinit(void);
+uint8_t sht40x_interface_i2c_deinit(void *pBus);
 
 /**
  * @brief      interface i2c bus read
+ * @param[in]  pBus is the bus context linked to the handle
  * @param[in]  u8Addr is the i2c device address 7 bit
  * @param[out] *pBuf points to a data buffer
  * @param[in]  u8length is the length of the data buffer
@@ -60,10 +61,11 @@ uint8_t sht40x_interface_i2c_deinit(void);
  *             - 1 read failed
  * @note       none
  */
-uint8_t sht40x_interface_i2c_read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+uint8_t sht40x_interface_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
 
 /**
  * @brief      interface i2c bus read
+ * @param[in]  pBus is the bus context linked to the handle
  * @param[in]  u8Addr is the i2c device address 7 bit
  * @param[out] *pBuf points to a data buffer
  * @param[in]  u8length is the length of the data buffer
@@ -72,7 +74,7 @@ uint8_t sht40x_interface_i2c_read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
  *             - 1 read failed
  * @note       none
  */
-uint8_t sht40x_interface_i2c_write(uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+uint8_t sht40x_interface_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
 
 /**
  * @brief     interface delay ms
@@ -0,0 +1,439 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_linux.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 AM
+ */
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L     /**< clock_gettime, nanosleep and O_CLOEXEC under -std=c99 */
+#endif
+
+#include "sht40x_driver_linux.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+/**
+* @brief This function returns the monotonic time in nanoseconds
+* @return time in nanoseconds
+* @note none
+*/
+static uint64_t a_sht40x_linux_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+* @brief This function issues one I2C_RDWR call and accounts it
+* @param[in] *pBus points to the bus structure
+* @param[in] *pMsgs points to the messages to transfer
+* @param[in] u8Count is the number of messages
+* @return status code
+*          - 0 success
+*          - 1 transfer failed
+* @note none
+*/
+static uint8_t a_sht40x_linux_transfer(sht40x_linux_bus_t *const pBus, struct i2c_msg *pMsgs, uint8_t u8Count)
+{
+    struct i2c_rdwr_ioctl_data xfer;
+    uint64_t u64Start;
+    uint64_t u64Time;
+    int ret;
+
+    if(pBus->fd < 0)
+    {
+        return 1;   /**< bus not opened */
+    }
+
+    xfer.msgs = pMsgs;
+    xfer.nmsgs = u8Count;
+
+    u64Start = a_sht40x_linux_now_ns();
+    do
+    {
+        ret = ioctl(pBus->fd, I2C_RDWR, &xfer);
+    } while((ret < 0) && (errno == EINTR));
+    u64Time = a_sht40x_linux_now_ns() - u64Start;
+
+    pBus->syscalls++;
+    pBus->messages += u8Count;
+    pBus->total_ns += u64Time;
+    if(u64Time > pBus->max_ns)
+        pBus->max_ns = (u64Time > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)u64Time;
+
+    if(ret != (int)u8Count)
+    {
+        pBus->errors++;
+        return 1;   /**< NACK or adapter error */
+    }
+
+    return 0;   /**< success */
+}
+
+/**
+* @brief This function checks and converts one measurement frame
+* @param[in] *pFrame points to the 6 byte frame
+* @param[out] *pData point to the sensor data to fill
+* @return status code
+*          - 0 success
+*          - 5 CRC mismatch
+* @note none
+*/
+static uint8_t a_sht40x_linux_decode(const uint8_t *pFrame, sht40x_data_t *pData)
+{
+    if((sht40x_crc8(&pFrame[0], 2) != pFrame[2]) || (sht40x_crc8(&pFrame[3], 2) != pFrame[5]))
+    {
+        return SHT40X_DRV_ERR_CRC;  /**< corrupted frame */
+    }
+
+    return sht40x_convert_ticks((uint16_t)((pFrame[0] << 8) | pFrame[1]), (uint16_t)((pFrame[3] << 8) | pFrame[4]), pData);
+}
+
+/**
+ * @brief     This function prepares a linux bus structure, the device is opened by i2c_init
+ * @param[in] *pBus points to the bus structure
+ * @param[in] u8Adapter is the adapter number N of /dev/i2c-N
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      none
+ */
+uint8_t sht40x_linux_bus_init(sht40x_linux_bus_t *const pBus, uint8_t u8Adapter)
+{
+    if(pBus == NULL)
+        return 2;     /**< return failed error */
+
+    memset(pBus, 0, sizeof(sht40x_linux_bus_t));
+    pBus->fd = -1;
+    pBus->adapter = u8Adapter;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief  linux i2c bus init, opens /dev/i2c-N on first use
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @return status code
+ *         - 0 success
+ *         - 1 i2c init failed
+ * @note   reference counted, several handles may share the bus
+ */
+uint8_t sht40x_linux_i2c_init(void *pBus)
+{
+    sht40x_linux_bus_t *pLinux = (sht40x_linux_bus_t *)pBus;
+    char path[20];
+
+    if(pLinux == NULL)
+        return 1;   /**< no bus linked */
+
+    if(pLinux->fd < 0)
+    {
+        snprintf(path, sizeof(path), "/dev/i2c-%u", (unsigned)pLinux->adapter);
+        pLinux->fd = open(path, O_RDWR | O_CLOEXEC);
+        if(pLinux->fd < 0)
+        {
+            return 1;   /**< adapter missing or no permission */
+        }
+    }
+    pLinux->users++;
+
+    return 0; /**< success */
+}
+
+/**
+ * @brief linux i2c bus deinit, closes /dev/i2c-N when the last handle leaves
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @return status code
+ *          - 0 success
+ *          - 1 i2c deinit fail
+ */
+uint8_t sht40x_linux_i2c_deinit(void *pBus)
+{
+    sht40x_linux_bus_t *pLinux = (sht40x_linux_bus_t *)pBus;
+
+    if((pLinux == NULL) || (pLinux->fd < 0) || (pLinux->users == 0))
+        return 1;   /**< bus not opened */
+
+    pLinux->users--;
+    if(pLinux->users == 0)
+    {
+        close(pLinux->fd);
+        pLinux->fd = -1;
+    }
+
+    return 0; /**< success */
+}
+
+/**
+ * @brief      linux i2c bus read, one I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t sht40x_linux_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    struct i2c_msg msg;
+
+    if(pBus == NULL)
+        return 1;   /**< no bus linked */
+
+    msg.addr = addr;
+    msg.flags = I2C_M_RD;
+    msg.len = u8Length;
+    msg.buf = pBuf;
+
+    return a_sht40x_linux_transfer((sht40x_linux_bus_t *)pBus, &msg, 1);
+}
+
+/**
+ * @brief      linux i2c bus write, one I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write failed
+ * @note       none
+ */
+uint8_t sht40x_linux_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    struct i2c_msg msg;
+
+    if(pBus == NULL)
+        return 1;   /**< no bus linked */
+
+    msg.addr = addr;
+    msg.flags = 0;
+    msg.len = u8Length;
+    msg.buf = pBuf;
+
+    return a_sht40x_linux_transfer((sht40x_linux_bus_t *)pBus, &msg, 1);
+}
+
+/**
+ * @brief      This function writes the same bytes to several devices in a single I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  *pAddr points to the 7 bit device addresses
+ * @param[in]  u8Count is the number of devices, at most SHT40X_LINUX_BATCH_MAX
+ * @param[in]  *pBuf points to the bytes to write
+ * @param[in]  u8Length is the number of bytes to write
+ * @return     status code
+ *             - 0 success
+ *             - 1 write failed
+ *             - 2 pBus, pAddr or pBuf is NULL or u8Count is out of range
+ * @note       the messages are joined by repeated starts, a single NACK fails the whole call
+ */
+uint8_t sht40x_linux_i2c_write_many(void *pBus, const uint8_t *pAddr, uint8_t u8Count, uint8_t *pBuf, uint8_t u8Length)
+{
+    struct i2c_msg msgs[SHT40X_LINUX_BATCH_MAX];
+    uint8_t index;
+
+    if((pBus == NULL) || (pAddr == NULL) || (pBuf == NULL) || (u8Count == 0) || (u8Count > SHT40X_LINUX_BATCH_MAX))
+        return 2;     /**< return failed error */
+
+    for(index = 0; index < u8Count; index++)
+    {
+        msgs[index].addr = pAddr[index];
+        msgs[index].flags = 0;
+        msgs[index].len = u8Length;
+        msgs[index].buf = pBuf;
+    }
+
+    return a_sht40x_linux_transfer((sht40x_linux_bus_t *)pBus, msgs, u8Count);
+}
+
+/**
+ * @brief      This function reads several devices in a single I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  *pAddr points to the 7 bit device addresses
+ * @param[in]  u8Count is the number of devices, at most SHT40X_LINUX_BATCH_MAX
+ * @param[out] *pBuf points to u8Count * u8Length bytes, device i at offset i * u8Length
+ * @param[in]  u8Length is the number of bytes to read from each device
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 pBus, pAddr or pBuf is NULL or u8Count is out of range
+ * @note       the messages are joined by repeated starts, a single NACK fails the whole call
+ */
+uint8_t sht40x_linux_i2c_read_many(void *pBus, const uint8_t *pAddr, uint8_t u8Count, uint8_t *pBuf, uint8_t u8Length)
+{
+    struct i2c_msg msgs[SHT40X_LINUX_BATCH_MAX];
+    uint8_t index;
+
+    if((pBus == NULL) || (pAddr == NULL) || (pBuf == NULL) || (u8Count == 0) || (u8Count > SHT40X_LINUX_BATCH_MAX))
+        return 2;     /**< return failed error */
+
+    for(index = 0; index < u8Count; index++)
+    {
+        msgs[index].addr = pAddr[index];
+        msgs[index].flags = I2C_M_RD;
+        msgs[index].len = u8Length;
+        msgs[index].buf = &pBuf[index * u8Length];
+    }
+
+    return a_sht40x_linux_transfer((sht40x_linux_bus_t *)pBus, msgs, u8Count);
+}
+
+/**
+ * @brief      This function measures several sensors of one adapter with two system calls
+ * @param[in]  *pBus points to the bus structure
+ * @param[in]  *pAddr points to the 7 bit sensor addresses (e.g. 0x44, 0x45, 0x46)
+ * @param[in]  u8Count is the number of sensors, at most SHT40X_LINUX_BATCH_MAX
+ * @param[in]  precision is the data read accuracy
+ * @param[out] *pData points to u8Count sensor data structures
+ * @param[out] *pStatus points to u8Count per sensor status codes (0 ok, 1 failed, 5 CRC mismatch)
+ * @return     status code
+ *             - 0 every sensor succeeded
+ *             - 1 at least one sensor failed, see pStatus
+ *             - 2 a pointer is NULL or u8Count or precision is out of range
+ * @note       one ioctl starts every conversion, one ioctl reads every result. A NACK stops a
+ *             batch after the sensors ahead of it were served: they are converting, or already
+ *             handed their result out once. A failed batch is therefore redone one sensor at a
+ *             time after a conversion time, so a single bad sensor is isolated.
+ */
+uint8_t sht40x_linux_group_get_temp_rh(sht40x_linux_bus_t *const pBus, const uint8_t *pAddr, uint8_t u8Count,
+                                       sht40x_precision_t precision, sht40x_data_t *pData, uint8_t *pStatus)
+{
+    uint8_t frames[SHT40X_LINUX_BATCH_MAX * RESPONSE_LENGTH];
+    uint8_t u8Cmd;
+    uint8_t index;
+    uint8_t u8Batched = 1;
+    uint8_t err = 0;
+
+    if((pBus == NULL) || (pAddr == NULL) || (pData == NULL) || (pStatus == NULL) || (u8Count == 0) || (u8Count > SHT40X_LINUX_BATCH_MAX) ||
+       (precision > SHT40X_PRECISION_LOWEST))
+        return 2;     /**< return failed error */
+
+    /** phase 1: start every conversion with one call, one by one if a sensor NACKed */
+    u8Cmd = READ_PRECISION[precision];
+    memset(pStatus, 0, u8Count);
+    if(sht40x_linux_i2c_write_many(pBus, pAddr, u8Count, &u8Cmd, 1) != 0)
+    {
+        u8Batched = 0;
+        sht40x_linux_delay_ms(MEASUREMENT_DELAY[precision]);      /**< the sensors ahead of the NACK are converting */
+        for(index = 0; index < u8Count; index++)
+        {
+            pStatus[index] = sht40x_linux_i2c_write(pBus, pAddr[index], &u8Cmd, 1);
+        }
+    }
+
+    sht40x_linux_delay_ms(MEASUREMENT_DELAY[precision]);      /**< wait for conversion to complete */
+
+    /** phase 2: read every result with one call, one by one if a sensor NACKed */
+    if((u8Batched == 0) || (sht40x_linux_i2c_read_many(pBus, pAddr, u8Count, frames, RESPONSE_LENGTH) != 0))
+    {
+        if(u8Batched == 1)
+        {
+            /** the sensors ahead of the NACK already handed their result out, measure again */
+            for(index = 0; index < u8Count; index++)
+            {
+                pStatus[index] = sht40x_linux_i2c_write(pBus, pAddr[index], &u8Cmd, 1);
+            }
+            sht40x_linux_delay_ms(MEASUREMENT_DELAY[precision]);
+        }
+        for(index = 0; index < u8Count; index++)
+        {
+            if(pStatus[index] == 0)
+                pStatus[index] = sht40x_linux_i2c_read(pBus, pAddr[index], &frames[index * RESPONSE_LENGTH], RESPONSE_LENGTH);
+        }
+    }
+
+    /** phase 3: check and convert */
+    for(index = 0; index < u8Count; index++)
+    {
+        if(pStatus[index] == 0)
+            pStatus[index] = a_sht40x_linux_decode(&frames[index * RESPONSE_LENGTH], &pData[index]);
+        if(pStatus[index] != 0)
+            err = 1;
+    }
+
+    return err;
+}
+
+/**
+ * @brief     linux delay ms
+ * @param[in] u32Ms is the time in milliseconds
+ * @note      none
+ */
+void sht40x_linux_delay_ms(uint32_t u32Ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec = u32Ms / 1000U;
+    ts.tv_nsec = (long)(u32Ms % 1000U) * 1000000L;
+    while((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+    {
+        /* resume the remaining time after a signal */
+    }
+}
+
+/**
+ * @brief     linux monotonic tick, suitable for DRIVER_SHT40X_LINK_GET_TICK_MS
+ * @return    milliseconds since an arbitrary start, wraps around
+ * @note      none
+ */
+uint32_t sht40x_linux_get_tick_ms(void)
+{
+    return (uint32_t)(a_sht40x_linux_now_ns() / 1000000ULL);
+}
+
+/**
+ * @brief     This function clears the system call counters of a bus
+ * @param[in] *pBus points to the bus structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      average kernel time per call is total_ns / syscalls
+ */
+uint8_t sht40x_linux_reset_stats(sht40x_linux_bus_t *const pBus)
+{
+    if(pBus == NULL)
+        return 2;     /**< return failed error */
+
+    pBus->syscalls = 0;
+    pBus->messages = 0;
+    pBus->errors = 0;
+    pBus->total_ns = 0;
+    pBus->max_ns = 0;
+
+    return 0;   /**< success */
+}
+
+#endif // __linux__
@@ -0,0 +1,200 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_linux.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 AM
+ */
+
+#ifndef SHT40X_DRIVER_LINUX_H_INCLUDED
+#define SHT40X_DRIVER_LINUX_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+#ifdef __linux__
+
+/**
+ * @defgroup sht40x_linux_driver sht40x linux i2c-dev transport function
+ * @brief    sht40x linux userspace transport through /dev/i2c-N and the I2C_RDWR ioctl
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+ * @brief max number of sensors served by one batched transfer
+ * @note  the kernel accepts up to 42 messages per I2C_RDWR call
+ */
+#define SHT40X_LINUX_BATCH_MAX          8U
+
+/**
+* @brief sht40x linux i2c bus structure definition
+* @note  one per adapter, shared by every handle on that adapter through DRIVER_SHT40X_LINK_I2C_BUS
+*/
+typedef struct sht40x_linux_bus_s
+{
+    int fd;                                                           /**< /dev/i2c-N file descriptor, -1 when closed */
+    uint8_t adapter;                                                  /**< adapter number N */
+    uint8_t users;                                                    /**< handles that initialized the bus */
+    uint32_t syscalls;                                                /**< I2C_RDWR calls issued */
+    uint32_t messages;                                                /**< i2c messages carried by those calls */
+    uint32_t errors;                                                  /**< I2C_RDWR calls that failed */
+    uint64_t total_ns;                                                /**< time spent inside I2C_RDWR */
+    uint32_t max_ns;                                                  /**< longest I2C_RDWR call */
+} sht40x_linux_bus_t;
+
+/**
+ * @brief     This function prepares a linux bus structure, the device is opened by i2c_init
+ * @param[in] *pBus points to the bus structure
+ * @param[in] u8Adapter is the adapter number N of /dev/i2c-N
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      none
+ */
+uint8_t sht40x_linux_bus_init(sht40x_linux_bus_t *const pBus, uint8_t u8Adapter);
+
+/**
+ * @brief  linux i2c bus init, opens /dev/i2c-N on first use
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @return status code
+ *         - 0 success
+ *         - 1 i2c init failed
+ * @note   reference counted, several handles may share the bus
+ */
+uint8_t sht40x_linux_i2c_init(void *pBus);
+
+/**
+ * @brief linux i2c bus deinit, closes /dev/i2c-N when the last handle leaves
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @return status code
+ *          - 0 success
+ *          - 1 i2c deinit fail
+ */
+uint8_t sht40x_linux_i2c_deinit(void *pBus);
+
+/**
+ * @brief      linux i2c bus read, one I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t sht40x_linux_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      linux i2c bus write, one I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write failed
+ * @note       none
+ */
+uint8_t sht40x_linux_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      This function writes the same bytes to several devices in a single I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  *pAddr points to the 7 bit device addresses
+ * @param[in]  u8Count is the number of devices, at most SHT40X_LINUX_BATCH_MAX
+ * @param[in]  *pBuf points to the bytes to write
+ * @param[in]  u8Length is the number of bytes to write
+ * @return     status code
+ *             - 0 success
+ *             - 1 write failed
+ *             - 2 pBus, pAddr or pBuf is NULL or u8Count is out of range
+ * @note       the messages are joined by repeated starts, a single NACK fails the whole call
+ */
+uint8_t sht40x_linux_i2c_write_many(void *pBus, const uint8_t *pAddr, uint8_t u8Count, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      This function reads several devices in a single I2C_RDWR call
+ * @param[in]  pBus points to a sht40x_linux_bus_t
+ * @param[in]  *pAddr points to the 7 bit device addresses
+ * @param[in]  u8Count is the number of devices, at most SHT40X_LINUX_BATCH_MAX
+ * @param[out] *pBuf points to u8Count * u8Length bytes, device i at offset i * u8Length
+ * @param[in]  u8Length is the number of bytes to read from each device
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 pBus, pAddr or pBuf is NULL or u8Count is out of range
+ * @note       the messages are joined by repeated starts, a single NACK fails the whole call
+ */
+uint8_t sht40x_linux_i2c_read_many(void *pBus, const uint8_t *pAddr, uint8_t u8Count, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      This function measures several sensors of one adapter with two system calls
+ * @param[in]  *pBus points to the bus structure
+ * @param[in]  *pAddr points to the 7 bit sensor addresses (e.g. 0x44, 0x45, 0x46)
+ * @param[in]  u8Count is the number of sensors, at most SHT40X_LINUX_BATCH_MAX
+ * @param[in]  precision is the data read accuracy
+ * @param[out] *pData points to u8Count sensor data structures
+ * @param[out] *pStatus points to u8Count per sensor status codes (0 ok, 1 failed, 5 CRC mismatch)
+ * @return     status code
+ *             - 0 every sensor succeeded
+ *             - 1 at least one sensor failed, see pStatus
+ *             - 2 a pointer is NULL or u8Count or precision is out of range
+ * @note       one ioctl starts every conversion, one ioctl reads every result. A NACK stops a
+ *             batch after the sensors ahead of it were served: they are converting, or already
+ *             handed their result out once. A failed batch is therefore redone one sensor at a
+ *             time after a conversion time, so a single bad sensor is isolated.
+ */
+uint8_t sht40x_linux_group_get_temp_rh(sht40x_linux_bus_t *const pBus, const uint8_t *pAddr, uint8_t u8Count,
+                                       sht40x_precision_t precision, sht40x_data_t *pData, uint8_t *pStatus);
+
+/**
+ * @brief     linux delay ms
+ * @param[in] u32Ms is the time in milliseconds
+ * @note      none
+ */
+void sht40x_linux_delay_ms(uint32_t u32Ms);
+
+/**
+ * @brief     linux monotonic tick, suitable for DRIVER_SHT40X_LINK_GET_TICK_MS
+ * @return    milliseconds since an arbitrary start, wraps around
+ * @note      none
+ */
+uint32_t sht40x_linux_get_tick_ms(void);
+
+/**
+ * @brief     This function clears the system call counters of a bus
+ * @param[in] *pBus points to the bus structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      average kernel time per call is total_ns / syscalls
+ */
+uint8_t sht40x_linux_reset_stats(sht40x_linux_bus_t *const pBus);
+
+/**
+ * @}
+ */
+
+#endif // __linux__
+
+#endif // SHT40X_DRIVER_LINUX_H_INCLUDED
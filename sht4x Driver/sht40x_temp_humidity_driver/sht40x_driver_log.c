@@ -0,0 +1,149 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_log.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:50 PM
+ */
+
+#include "sht40x_driver_log.h"
+
+/**
+* @brief This function serializes one entry for sht40x_dump_ring_write
+* @param[in] *pEntries points to the log entries
+* @param[in] u16Slot is the storage index of the entry
+* @param[out] *pBuf points to SHT40X_LOG_ENTRY_SIZE bytes
+* @return none
+* @note none
+*/
+static void a_sht40x_log_serialize(const void *pEntries, uint16_t u16Slot, uint8_t *pBuf)
+{
+    const sht40x_log_entry_t *pEntry = &((const sht40x_log_entry_t *)pEntries)[u16Slot];
+
+    sht40x_dump_put32(&pBuf[0], pEntry->timestamp);
+    pBuf[4] = pEntry->event;
+    pBuf[5] = pEntry->address;
+    sht40x_dump_put16(&pBuf[6], pEntry->argument);
+}
+
+/**
+ * @brief     This function initializes a log ring
+ * @param[in] *pLog points to the ring structure
+ * @param[in] *pEntries points to the caller provided storage
+ * @param[in] u16Size is the number of entries, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pLog or pEntries is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_LOG (SHT40X_LOG), several handles may share a ring
+ */
+uint8_t sht40x_log_init(sht40x_log_t *const pLog, sht40x_log_entry_t *pEntries, uint16_t u16Size)
+{
+    if((pLog == NULL) || (pEntries == NULL))
+        return 2;     /**< return failed error */
+    if(sht40x_dump_ring_init(&pLog->ring, u16Size) != 0)
+        return 1;     /**< size must be a power of two */
+
+    pLog->pEntries = pEntries;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function records one event
+ * @param[in] *pLog points to the ring structure
+ * @param[in] u32Timestamp is the time of the event in ms
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u8Event is the sht40x_log_event_t
+ * @param[in] u16Argument is the event argument
+ * @return    none
+ * @note      four stores and a ring index update, no formatting and no wait
+ */
+void sht40x_log_record(sht40x_log_t *const pLog, uint32_t u32Timestamp, uint8_t u8Address, uint8_t u8Event, uint16_t u16Argument)
+{
+    sht40x_log_entry_t *pEntry = &pLog->pEntries[sht40x_dump_ring_next(&pLog->ring)];
+
+    pEntry->timestamp = u32Timestamp;
+    pEntry->event = u8Event;
+    pEntry->address = u8Address;
+    pEntry->argument = u16Argument;
+}
+
+/**
+ * @brief     This function returns the number of entries held
+ * @param[in] *pLog points to the ring structure
+ * @return    entries held, at most the ring size
+ * @note      none
+ */
+uint16_t sht40x_log_count(const sht40x_log_t *const pLog)
+{
+    return sht40x_dump_ring_count(&pLog->ring);
+}
+
+/**
+ * @brief     This function reads an entry, oldest first
+ * @param[in] *pLog points to the ring structure
+ * @param[in] u16Index is 0 for the oldest entry held
+ * @param[out] *pEntry points to the entry to fill
+ * @return  status code
+ *            - 0 success
+ *            - 1 index out of range
+ *            - 2 pLog or pEntry is NULL
+ * @note      none
+ */
+uint8_t sht40x_log_get(const sht40x_log_t *const pLog, uint16_t u16Index, sht40x_log_entry_t *pEntry)
+{
+    uint16_t u16Slot;
+
+    if((pLog == NULL) || (pEntry == NULL))
+        return 2;     /**< return failed error */
+
+    if(sht40x_dump_ring_slot(&pLog->ring, u16Index, &u16Slot) != 0)
+        return 1;     /**< nothing recorded there */
+
+    *pEntry = pLog->pEntries[u16Slot];
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function serializes the ring for tools/sht40x_log_decode
+ * @param[in] *pLog points to the ring structure
+ * @param[in] output is called with consecutive chunks of the dump
+ * @param[in] *pContext is passed to output
+ * @return  status code
+ *            - 0 success
+ *            - 2 pLog or output is NULL
+ * @note      16 byte header (magic, entry size, entry count, lost entries) then the entries oldest
+ *            first, little endian, 8 bytes each. Stop recording while dumping.
+ */
+uint8_t sht40x_log_dump(const sht40x_log_t *const pLog, void (*output)(void *pContext, const uint8_t *pBuf, uint8_t u8Length),
+                        void *pContext)
+{
+    if((pLog == NULL) || (output == NULL))
+        return 2;     /**< return failed error */
+
+    sht40x_dump_ring_write(&pLog->ring, SHT40X_LOG_MAGIC, SHT40X_LOG_ENTRY_SIZE, a_sht40x_log_serialize, pLog->pEntries,
+                           output, pContext);
+
+    return 0;   /**< success */
+}
@@ -0,0 +1,161 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_log.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 09:50 PM
+ */
+
+#ifndef SHT40X_DRIVER_LOG_H_INCLUDED
+#define SHT40X_DRIVER_LOG_H_INCLUDED
+
+#include "sht40x_driver.h"
+#include "sht40x_driver_dump.h"
+
+/**
+ * @defgroup sht40x_log_driver sht40x deferred log function
+ * @brief    driver messages recorded as (event, argument) pairs, rendered on the host by tools/sht40x_log_decode
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_LOG_MAGIC                "SHT4XLG1"      /**< dump header magic, 8 bytes */
+#define SHT40X_LOG_HEADER_SIZE          SHT40X_DUMP_HEADER_SIZE /**< dump header size */
+#define SHT40X_LOG_ENTRY_SIZE           8U              /**< dump entry size */
+
+ /**
+ * @brief sht40x log event enumeration
+ * @note  the values are part of the dump format, append new events, never renumber
+ */
+typedef enum
+{
+    SHT40X_LOG_CRC_ERROR            = 0x01,                           /**< argument: received CRC bytes, word 0 high */
+    SHT40X_LOG_LINK_MISSING         = 0x02,                           /**< argument: 0 delay, 1 i2c_init, 2 i2c_deinit, 3 i2c_read, 4 i2c_write */
+    SHT40X_LOG_I2C_INIT_FAILED      = 0x03,                           /**< argument: none */
+    SHT40X_LOG_I2C_DEINIT_FAILED    = 0x04,                           /**< argument: none */
+    SHT40X_LOG_SET_ADDRESS_FAILED   = 0x05,                           /**< argument: requested address code */
+    SHT40X_LOG_GET_ADDRESS_FAILED   = 0x06,                           /**< argument: none */
+    SHT40X_LOG_SET_VARIANT_FAILED   = 0x07,                           /**< argument: requested variant */
+    SHT40X_LOG_GET_VARIANT_FAILED   = 0x08,                           /**< argument: none */
+    SHT40X_LOG_NO_MEASUREMENT       = 0x09,                           /**< argument: pending command */
+    SHT40X_LOG_MEASURE_READ_FAILED  = 0x0A,                           /**< argument: precision */
+    SHT40X_LOG_MEASURE_CMD_FAILED   = 0x0B,                           /**< argument: precision */
+    SHT40X_LOG_INVALID_PRECISION    = 0x0C,                           /**< argument: precision */
+    SHT40X_LOG_SERIAL_READ_FAILED   = 0x0D,                           /**< argument: none */
+    SHT40X_LOG_SERIAL_CMD_FAILED    = 0x0E,                           /**< argument: none */
+    SHT40X_LOG_HEATER_CMD_FAILED    = 0x0F,                           /**< argument: heater power */
+    SHT40X_LOG_NO_HEATER            = 0x10,                           /**< argument: pending command */
+    SHT40X_LOG_HEATER_READ_FAILED   = 0x11,                           /**< argument: heater power */
+    SHT40X_LOG_RESET_FAILED         = 0x12,                           /**< argument: none */
+    SHT40X_LOG_INVALID_HEATER_POWER = 0x13,                           /**< argument: heater power */
+    SHT40X_LOG_INIT                 = 0x40,                           /**< argument: none, information */
+    SHT40X_LOG_RESET                = 0x41,                           /**< argument: none, information */
+    SHT40X_LOG_BUSY_NACK            = 0x42                            /**< argument: ms since the command, information */
+} sht40x_log_event_t;
+
+/**
+* @brief sht40x log entry structure definition
+* @note  8 bytes, dumped field by field in little endian order
+*/
+typedef struct sht40x_log_entry_s
+{
+    uint32_t timestamp;                                               /**< clock tick in ms, 0 without a clock */
+    uint8_t event;                                                    /**< sht40x_log_event_t */
+    uint8_t address;                                                  /**< 7 bit i2c address of the handle */
+    uint16_t argument;                                                /**< event argument */
+} sht40x_log_entry_t;
+
+/**
+* @brief sht40x log ring structure definition
+* @note  the newest entries overwrite the oldest
+*/
+typedef struct sht40x_log_s
+{
+    sht40x_log_entry_t *pEntries;                                     /**< caller provided storage */
+    sht40x_dump_ring_t ring;                                          /**< indexes of pEntries */
+} sht40x_log_t;
+
+/**
+ * @brief     This function initializes a log ring
+ * @param[in] *pLog points to the ring structure
+ * @param[in] *pEntries points to the caller provided storage
+ * @param[in] u16Size is the number of entries, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pLog or pEntries is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_LOG (SHT40X_LOG), several handles may share a ring
+ */
+uint8_t sht40x_log_init(sht40x_log_t *const pLog, sht40x_log_entry_t *pEntries, uint16_t u16Size);
+
+/**
+ * @brief     This function records one event
+ * @param[in] *pLog points to the ring structure
+ * @param[in] u32Timestamp is the time of the event in ms
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u8Event is the sht40x_log_event_t
+ * @param[in] u16Argument is the event argument
+ * @return    none
+ * @note      four stores and a ring index update, no formatting and no wait
+ */
+void sht40x_log_record(sht40x_log_t *const pLog, uint32_t u32Timestamp, uint8_t u8Address, uint8_t u8Event, uint16_t u16Argument);
+
+/**
+ * @brief     This function returns the number of entries held
+ * @param[in] *pLog points to the ring structure
+ * @return    entries held, at most the ring size
+ * @note      none
+ */
+uint16_t sht40x_log_count(const sht40x_log_t *const pLog);
+
+/**
+ * @brief     This function reads an entry, oldest first
+ * @param[in] *pLog points to the ring structure
+ * @param[in] u16Index is 0 for the oldest entry held
+ * @param[out] *pEntry points to the entry to fill
+ * @return  status code
+ *            - 0 success
+ *            - 1 index out of range
+ *            - 2 pLog or pEntry is NULL
+ * @note      none
+ */
+uint8_t sht40x_log_get(const sht40x_log_t *const pLog, uint16_t u16Index, sht40x_log_entry_t *pEntry);
+
+/**
+ * @brief     This function serializes the ring for tools/sht40x_log_decode
+ * @param[in] *pLog points to the ring structure
+ * @param[in] output is called with consecutive chunks of the dump
+ * @param[in] *pContext is passed to output
+ * @return  status code
+ *            - 0 success
+ *            - 2 pLog or output is NULL
+ * @note      16 byte header (magic, entry size, entry count, lost entries) then the entries oldest
+ *            first, little endian, 8 bytes each. Stop recording while dumping.
+ */
+uint8_t sht40x_log_dump(const sht40x_log_t *const pLog, void (*output)(void *pContext, const uint8_t *pBuf, uint8_t u8Length),
+                        void *pContext);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_LOG_H_INCLUDED
@@ -0,0 +1,194 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_lut.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 06:20 PM
+ */
+
+#include "sht40x_driver_lut.h"
+
+/**
+* @brief Conversion formulas of sht40x_driver.h, evaluated by the compiler
+*/
+#define SHT40X_LUT_RH_CLAMP(t)  ((SHT40X_CONVERT_RH_mRH(t) < HUMIDITY_MIN_MILLI) ? HUMIDITY_MIN_MILLI : \
+                                 (SHT40X_CONVERT_RH_mRH(t) > HUMIDITY_MAX_MILLI) ? HUMIDITY_MAX_MILLI : SHT40X_CONVERT_RH_mRH(t))
+
+#define SHT40X_LUT_T_COARSE(i)  SHT40X_CONVERT_T_mC((uint32_t)(i) << SHT40X_LUT_SEGMENT_SHIFT)
+#define SHT40X_LUT_RH_COARSE(i) SHT40X_CONVERT_RH_mRH((uint32_t)(i) << SHT40X_LUT_SEGMENT_SHIFT)
+
+/**
+* @brief Table generators, SHT40X_LUT_REPn(M, b) expands M(b * 16^n + 0) .. M(b * 16^n + 16^n - 1)
+*/
+#define SHT40X_LUT_REP1(M, b)   M((b) * 16 + 0),  M((b) * 16 + 1),  M((b) * 16 + 2),  M((b) * 16 + 3),  \
+                                M((b) * 16 + 4),  M((b) * 16 + 5),  M((b) * 16 + 6),  M((b) * 16 + 7),  \
+                                M((b) * 16 + 8),  M((b) * 16 + 9),  M((b) * 16 + 10), M((b) * 16 + 11), \
+                                M((b) * 16 + 12), M((b) * 16 + 13), M((b) * 16 + 14), M((b) * 16 + 15)
+#define SHT40X_LUT_REP2(M, b)   SHT40X_LUT_REP1(M, (b) * 16 + 0),  SHT40X_LUT_REP1(M, (b) * 16 + 1),  \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 2),  SHT40X_LUT_REP1(M, (b) * 16 + 3),  \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 4),  SHT40X_LUT_REP1(M, (b) * 16 + 5),  \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 6),  SHT40X_LUT_REP1(M, (b) * 16 + 7),  \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 8),  SHT40X_LUT_REP1(M, (b) * 16 + 9),  \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 10), SHT40X_LUT_REP1(M, (b) * 16 + 11), \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 12), SHT40X_LUT_REP1(M, (b) * 16 + 13), \
+                                SHT40X_LUT_REP1(M, (b) * 16 + 14), SHT40X_LUT_REP1(M, (b) * 16 + 15)
+
+/**
+* @brief Coarse tables, exact values at every 256th tick plus the 65536 end point
+* @note  humidity is kept unclamped so the interpolation stays linear, the clamp follows it
+*/
+static int32_t const SHT40X_LUT_COARSE_T[SHT40X_LUT_COARSE_SIZE] = {
+    SHT40X_LUT_REP2(SHT40X_LUT_T_COARSE, 0), SHT40X_LUT_T_COARSE(256)
+};
+
+static int32_t const SHT40X_LUT_COARSE_RH[SHT40X_LUT_COARSE_SIZE] = {
+    SHT40X_LUT_REP2(SHT40X_LUT_RH_COARSE, 0), SHT40X_LUT_RH_COARSE(256)
+};
+
+#ifdef SHT40X_LUT_FULL
+#define SHT40X_LUT_REP3(M, b)   SHT40X_LUT_REP2(M, (b) * 16 + 0),  SHT40X_LUT_REP2(M, (b) * 16 + 1),  \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 2),  SHT40X_LUT_REP2(M, (b) * 16 + 3),  \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 4),  SHT40X_LUT_REP2(M, (b) * 16 + 5),  \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 6),  SHT40X_LUT_REP2(M, (b) * 16 + 7),  \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 8),  SHT40X_LUT_REP2(M, (b) * 16 + 9),  \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 10), SHT40X_LUT_REP2(M, (b) * 16 + 11), \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 12), SHT40X_LUT_REP2(M, (b) * 16 + 13), \
+                                SHT40X_LUT_REP2(M, (b) * 16 + 14), SHT40X_LUT_REP2(M, (b) * 16 + 15)
+#define SHT40X_LUT_REP4(M, b)   SHT40X_LUT_REP3(M, (b) * 16 + 0),  SHT40X_LUT_REP3(M, (b) * 16 + 1),  \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 2),  SHT40X_LUT_REP3(M, (b) * 16 + 3),  \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 4),  SHT40X_LUT_REP3(M, (b) * 16 + 5),  \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 6),  SHT40X_LUT_REP3(M, (b) * 16 + 7),  \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 8),  SHT40X_LUT_REP3(M, (b) * 16 + 9),  \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 10), SHT40X_LUT_REP3(M, (b) * 16 + 11), \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 12), SHT40X_LUT_REP3(M, (b) * 16 + 13), \
+                                SHT40X_LUT_REP3(M, (b) * 16 + 14), SHT40X_LUT_REP3(M, (b) * 16 + 15)
+
+/**
+* @brief Full tables, one entry per tick, humidity clamp included
+*/
+static int32_t const SHT40X_LUT_FULL_T[65536] = {
+    SHT40X_LUT_REP4(SHT40X_CONVERT_T_mC, 0)
+};
+
+static int32_t const SHT40X_LUT_FULL_RH[65536] = {
+    SHT40X_LUT_REP4(SHT40X_LUT_RH_CLAMP, 0)
+};
+#endif // SHT40X_LUT_FULL
+
+/**
+* @brief This function interpolates inside one coarse segment
+* @param[in] *pTable points to a coarse table
+* @param[in] u16Ticks is the raw word
+* @return interpolated value
+* @note none
+*/
+static int32_t a_sht40x_lut_interpolate(const int32_t *pTable, uint16_t u16Ticks)
+{
+    uint16_t u16Segment = u16Ticks >> SHT40X_LUT_SEGMENT_SHIFT;
+    uint16_t u16Offset = u16Ticks & ((1U << SHT40X_LUT_SEGMENT_SHIFT) - 1U);
+    int32_t s32Low = pTable[u16Segment];
+
+    return s32Low + (((pTable[u16Segment + 1] - s32Low) * (int32_t)u16Offset + (1L << (SHT40X_LUT_SEGMENT_SHIFT - 1))) >> SHT40X_LUT_SEGMENT_SHIFT);
+}
+
+/**
+ * @brief     This function converts temperature ticks with the coarse table
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      linear interpolation between 257 entries, within 1 mC of sht40x_convert_temperature_mC
+ */
+int32_t sht40x_lut_temperature_mC(uint16_t u16Ticks)
+{
+    return a_sht40x_lut_interpolate(SHT40X_LUT_COARSE_T, u16Ticks);
+}
+
+/**
+ * @brief     This function converts humidity ticks with the coarse table
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      linear interpolation between 257 entries, within 1 m%RH of sht40x_convert_humidity_mRH
+ */
+int32_t sht40x_lut_humidity_mRH(uint16_t u16Ticks)
+{
+    int32_t s32Humidity = a_sht40x_lut_interpolate(SHT40X_LUT_COARSE_RH, u16Ticks);
+
+    s32Humidity = s32Humidity > HUMIDITY_MAX_MILLI ? HUMIDITY_MAX_MILLI : s32Humidity;  /**< if humidity is high than max allowed, set to 100 % */
+    s32Humidity = s32Humidity < HUMIDITY_MIN_MILLI ? HUMIDITY_MIN_MILLI : s32Humidity;  /**< if humidity is less than min allowed, set to 0 % */
+
+    return s32Humidity;
+}
+
+#ifdef SHT40X_LUT_FULL
+/**
+ * @brief     This function converts temperature ticks with the full table
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      one table read, same result as sht40x_convert_temperature_mC
+ */
+int32_t sht40x_lut_full_temperature_mC(uint16_t u16Ticks)
+{
+    return SHT40X_LUT_FULL_T[u16Ticks];
+}
+
+/**
+ * @brief     This function converts humidity ticks with the full table
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      one table read, clamp included, same result as sht40x_convert_humidity_mRH
+ */
+int32_t sht40x_lut_full_humidity_mRH(uint16_t u16Ticks)
+{
+    return SHT40X_LUT_FULL_RH[u16Ticks];
+}
+#endif // SHT40X_LUT_FULL
+
+/**
+ * @brief     This function converts an array of raw ticks
+ * @param[in] *pTicks point to the raw ticks
+ * @param[in] u32Count is the number of samples
+ * @param[out] *pTemperature_mC point to the temperatures in milli degree Celsius
+ * @param[out] *pHumidity_mRH point to the relative humidities in milli percent
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      full table when SHT40X_LUT_FULL is defined, coarse table otherwise, same layout as sht40x_convert_batch
+ */
+uint8_t sht40x_lut_convert(const sht40x_ticks_t *pTicks, uint32_t u32Count, int32_t *pTemperature_mC, int32_t *pHumidity_mRH)
+{
+    uint32_t index;
+
+    if((pTicks == NULL) || (pTemperature_mC == NULL) || (pHumidity_mRH == NULL))
+        return 2;
+
+    for(index = 0; index < u32Count; index++)
+    {
+#ifdef SHT40X_LUT_FULL
+        pTemperature_mC[index] = SHT40X_LUT_FULL_T[pTicks[index].temperature];
+        pHumidity_mRH[index] = SHT40X_LUT_FULL_RH[pTicks[index].humidity];
+#else
+        pTemperature_mC[index] = sht40x_lut_temperature_mC(pTicks[index].temperature);
+        pHumidity_mRH[index] = sht40x_lut_humidity_mRH(pTicks[index].humidity);
+#endif // SHT40X_LUT_FULL
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_lut.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 06:20 PM
+ */
+
+#ifndef SHT40X_DRIVER_LUT_H_INCLUDED
+#define SHT40X_DRIVER_LUT_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sht40x_lut_driver sht40x lookup table conversion function
+ * @brief    raw ticks to milli-units through tables built by the preprocessor
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_LUT_SEGMENT_SHIFT        8U              /**< ticks per coarse table segment, 2^8 */
+#define SHT40X_LUT_COARSE_SIZE          257U            /**< coarse entries, one per segment edge */
+
+/**
+ * @brief     This function converts temperature ticks with the coarse table
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      linear interpolation between 257 entries, within 1 mC of sht40x_convert_temperature_mC
+ */
+int32_t sht40x_lut_temperature_mC(uint16_t u16Ticks);
+
+/**
+ * @brief     This function converts humidity ticks with the coarse table
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      linear interpolation between 257 entries, within 1 m%RH of sht40x_convert_humidity_mRH
+ */
+int32_t sht40x_lut_humidity_mRH(uint16_t u16Ticks);
+
+#ifdef SHT40X_LUT_FULL
+/**
+ * @brief     This function converts temperature ticks with the full table
+ * @param[in] u16Ticks is the raw temperature word
+ * @return    temperature in milli degree Celsius
+ * @note      one table read, same result as sht40x_convert_temperature_mC
+ */
+int32_t sht40x_lut_full_temperature_mC(uint16_t u16Ticks);
+
+/**
+ * @brief     This function converts humidity ticks with the full table
+ * @param[in] u16Ticks is the raw humidity word
+ * @return    clamped relative humidity in milli percent
+ * @note      one table read, clamp included, same result as sht40x_convert_humidity_mRH
+ */
+int32_t sht40x_lut_full_humidity_mRH(uint16_t u16Ticks);
+#endif // SHT40X_LUT_FULL
+
+/**
+ * @brief     This function converts an array of raw ticks
+ * @param[in] *pTicks point to the raw ticks
+ * @param[in] u32Count is the number of samples
+ * @param[out] *pTemperature_mC point to the temperatures in milli degree Celsius
+ * @param[out] *pHumidity_mRH point to the relative humidities in milli percent
+ * @return  status code
+ *            - 0 success
+ *            - 2 a pointer is NULL
+ * @note      full table when SHT40X_LUT_FULL is defined, coarse table otherwise, same layout as sht40x_convert_batch
+ */
+uint8_t sht40x_lut_convert(const sht40x_ticks_t *pTicks, uint32_t u32Count, int32_t *pTemperature_mC, int32_t *pHumidity_mRH);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SHT40X_DRIVER_LUT_H_INCLUDED
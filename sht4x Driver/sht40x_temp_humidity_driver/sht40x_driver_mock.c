@@ -0,0 +1,292 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_mock.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 03:10 PM
+ */
+
+#include "sht40x_driver_mock.h"
+
+/**
+* @brief This function takes the next script step
+* @param[in] *pMock points to the mock structure
+* @return step, NULL when the script is exhausted
+* @note none
+*/
+static sht40x_mock_step_t *a_sht40x_mock_next(sht40x_mock_t *const pMock)
+{
+    pMock->transfers++;
+    if((pMock->index >= pMock->count) && (pMock->repeat == 1))
+    {
+        pMock->index = 0;     /**< replay the script from the start */
+    }
+    if(pMock->index >= pMock->count)
+    {
+        return NULL;
+    }
+    return &pMock->steps[pMock->index++];
+}
+
+/**
+* @brief This function appends a script step
+* @param[in] *pMock points to the mock structure
+* @return step, NULL when the script is full
+* @note none
+*/
+static sht40x_mock_step_t *a_sht40x_mock_append(sht40x_mock_t *const pMock)
+{
+    if(pMock->count >= SHT40X_MOCK_STEPS_MAX)
+    {
+        return NULL;
+    }
+    memset(&pMock->steps[pMock->count], 0, sizeof(sht40x_mock_step_t));
+    return &pMock->steps[pMock->count++];
+}
+
+/**
+ * @brief     This function clears a mock script
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Repeat is 1 to replay the script endlessly, 0 to replay it once
+ * @return  status code
+ *            - 0 success
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_init(sht40x_mock_t *const pMock, uint8_t u8Repeat)
+{
+    if(pMock == NULL)
+        return 2;     /**< return failed error */
+
+    memset(pMock, 0, sizeof(sht40x_mock_t));
+    pMock->repeat = u8Repeat;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function appends an expected command write
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] u8Cmd is the expected command
+ * @param[in] u8Result is returned to the driver, 1 simulates a NACK
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_write(sht40x_mock_t *const pMock, uint8_t u8Address, uint8_t u8Cmd, uint8_t u8Result)
+{
+    sht40x_mock_step_t *pStep;
+
+    if(pMock == NULL)
+        return 2;     /**< return failed error */
+
+    pStep = a_sht40x_mock_append(pMock);
+    if(pStep == NULL)
+        return 1;     /**< script full */
+
+    pStep->op = SHT40X_MOCK_WRITE;
+    pStep->address = u8Address;
+    pStep->length = 1;
+    pStep->result = u8Result;
+    pStep->data[0] = u8Cmd;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function appends an expected read and the bytes it returns
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] *pData points to the response, NULL for a NACKed read
+ * @param[in] u8Length is the expected length, at most RESPONSE_LENGTH
+ * @param[in] u8Result is returned to the driver, 1 simulates a NACK
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full or length too long
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_read(sht40x_mock_t *const pMock, uint8_t u8Address, const uint8_t *pData, uint8_t u8Length, uint8_t u8Result)
+{
+    sht40x_mock_step_t *pStep;
+
+    if(pMock == NULL)
+        return 2;     /**< return failed error */
+    if(u8Length > RESPONSE_LENGTH)
+        return 1;     /**< response too long */
+
+    pStep = a_sht40x_mock_append(pMock);
+    if(pStep == NULL)
+        return 1;     /**< script full */
+
+    pStep->op = SHT40X_MOCK_READ;
+    pStep->address = u8Address;
+    pStep->length = u8Length;
+    pStep->result = u8Result;
+    if(pData != NULL)
+        memcpy(pStep->data, pData, u8Length);
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function appends a measurement command and its response with valid CRC
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] u8Cmd is the expected measurement or heater command
+ * @param[in] u16Temperature is the raw temperature word returned
+ * @param[in] u16Humidity is the raw humidity word returned
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_measurement(sht40x_mock_t *const pMock, uint8_t u8Address, uint8_t u8Cmd, uint16_t u16Temperature, uint16_t u16Humidity)
+{
+    uint8_t frame[RESPONSE_LENGTH];
+    uint8_t err;
+
+    if(pMock == NULL)
+        return 2;     /**< return failed error */
+    if((pMock->count + 2U) > SHT40X_MOCK_STEPS_MAX)
+        return 1;     /**< script full */
+
+    frame[0] = (uint8_t)(u16Temperature >> 8);
+    frame[1] = (uint8_t)(u16Temperature & 0xFF);
+    frame[2] = sht40x_crc8(&frame[0], 2);
+    frame[3] = (uint8_t)(u16Humidity >> 8);
+    frame[4] = (uint8_t)(u16Humidity & 0xFF);
+    frame[5] = sht40x_crc8(&frame[3], 2);
+
+    err = sht40x_mock_expect_write(pMock, u8Address, u8Cmd, 0);
+    if(err)
+        return err;
+    return sht40x_mock_expect_read(pMock, u8Address, frame, RESPONSE_LENGTH, 0);
+}
+
+/**
+ * @brief     This function checks that the script was replayed exactly
+ * @param[in] *pMock points to the mock structure
+ * @return  status code
+ *            - 0 every step replayed, no mismatch
+ *            - 1 steps left or mismatches seen
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_verify(sht40x_mock_t *const pMock)
+{
+    if(pMock == NULL)
+        return 2;     /**< return failed error */
+
+    return ((pMock->mismatches == 0) && (pMock->index == pMock->count)) ? 0 : 1;
+}
+
+/**
+ * @brief  mock i2c bus init
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @return status code
+ *         - 0 success
+ *         - 1 pBus is NULL
+ * @note   none
+ */
+uint8_t sht40x_mock_i2c_init(void *pBus)
+{
+    return (pBus == NULL) ? 1 : 0;
+}
+
+/**
+ * @brief mock i2c bus deinit
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @return status code
+ *          - 0 success
+ *          - 1 pBus is NULL
+ */
+uint8_t sht40x_mock_i2c_deinit(void *pBus)
+{
+    return (pBus == NULL) ? 1 : 0;
+}
+
+/**
+ * @brief      mock i2c bus read
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scripted NACK or transfer not matching the script
+ * @note       none
+ */
+uint8_t sht40x_mock_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_mock_step_t *pStep;
+
+    if(pBus == NULL)
+        return 1;   /**< no bus linked */
+
+    pStep = a_sht40x_mock_next((sht40x_mock_t *)pBus);
+    if((pStep == NULL) || (pStep->op != SHT40X_MOCK_READ) || (pStep->address != addr) || (pStep->length != u8Length))
+    {
+        ((sht40x_mock_t *)pBus)->mismatches++;
+        return 1;   /**< unexpected transfer */
+    }
+    if(pStep->result != 0)
+    {
+        return pStep->result;   /**< scripted NACK */
+    }
+
+    memcpy(pBuf, pStep->data, u8Length);
+    return 0;   /**< success */
+}
+
+/**
+ * @brief      mock i2c bus write
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scripted NACK or transfer not matching the script
+ * @note       none
+ */
+uint8_t sht40x_mock_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_mock_step_t *pStep;
+
+    if(pBus == NULL)
+        return 1;   /**< no bus linked */
+
+    pStep = a_sht40x_mock_next((sht40x_mock_t *)pBus);
+    if((pStep == NULL) || (pStep->op != SHT40X_MOCK_WRITE) || (pStep->address != addr) || (pStep->length != u8Length)
+       || (memcmp(pStep->data, pBuf, u8Length) != 0))
+    {
+        ((sht40x_mock_t *)pBus)->mismatches++;
+        return 1;   /**< unexpected transfer */
+    }
+
+    return pStep->result;
+}
@@ -0,0 +1,191 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_mock.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 03:10 PM
+ */
+
+#ifndef SHT40X_DRIVER_MOCK_H_INCLUDED
+#define SHT40X_DRIVER_MOCK_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_mock_driver sht40x scripted transport function
+ * @brief    i2c transport replaying a script of expected transfers
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_MOCK_STEPS_MAX           32U             /**< transfers a script can hold */
+
+/**
+* @brief sht40x mock transfer enumeration
+*/
+typedef enum
+{
+    SHT40X_MOCK_WRITE = 0x00,                                         /**< expect a write */
+    SHT40X_MOCK_READ  = 0x01                                          /**< expect a read */
+} sht40x_mock_op_t;
+
+/**
+* @brief sht40x mock script step structure definition
+*/
+typedef struct sht40x_mock_step_s
+{
+    uint8_t op;                                                       /**< sht40x_mock_op_t */
+    uint8_t address;                                                  /**< expected 7 bit address */
+    uint8_t length;                                                   /**< expected length */
+    uint8_t result;                                                   /**< value returned to the driver, 1 simulates a NACK */
+    uint8_t data[RESPONSE_LENGTH];                                    /**< expected write bytes or read response */
+} sht40x_mock_step_t;
+
+/**
+* @brief sht40x mock transport structure definition
+*/
+typedef struct sht40x_mock_s
+{
+    sht40x_mock_step_t steps[SHT40X_MOCK_STEPS_MAX];                  /**< script */
+    uint8_t count;                                                    /**< steps in the script */
+    uint8_t index;                                                    /**< next step to replay */
+    uint8_t repeat;                                                   /**< 1 restarts the script when it ends */
+    uint32_t transfers;                                               /**< transfers seen */
+    uint32_t mismatches;                                              /**< transfers that did not match the script */
+} sht40x_mock_t;
+
+/**
+ * @brief     This function clears a mock script
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Repeat is 1 to replay the script endlessly, 0 to replay it once
+ * @return  status code
+ *            - 0 success
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_init(sht40x_mock_t *const pMock, uint8_t u8Repeat);
+
+/**
+ * @brief     This function appends an expected command write
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] u8Cmd is the expected command
+ * @param[in] u8Result is returned to the driver, 1 simulates a NACK
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_write(sht40x_mock_t *const pMock, uint8_t u8Address, uint8_t u8Cmd, uint8_t u8Result);
+
+/**
+ * @brief     This function appends an expected read and the bytes it returns
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] *pData points to the response, NULL for a NACKed read
+ * @param[in] u8Length is the expected length, at most RESPONSE_LENGTH
+ * @param[in] u8Result is returned to the driver, 1 simulates a NACK
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full or length too long
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_read(sht40x_mock_t *const pMock, uint8_t u8Address, const uint8_t *pData, uint8_t u8Length, uint8_t u8Result);
+
+/**
+ * @brief     This function appends a measurement command and its response with valid CRC
+ * @param[in] *pMock points to the mock structure
+ * @param[in] u8Address is the expected 7 bit address
+ * @param[in] u8Cmd is the expected measurement or heater command
+ * @param[in] u16Temperature is the raw temperature word returned
+ * @param[in] u16Humidity is the raw humidity word returned
+ * @return  status code
+ *            - 0 success
+ *            - 1 script full
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_expect_measurement(sht40x_mock_t *const pMock, uint8_t u8Address, uint8_t u8Cmd, uint16_t u16Temperature, uint16_t u16Humidity);
+
+/**
+ * @brief     This function checks that the script was replayed exactly
+ * @param[in] *pMock points to the mock structure
+ * @return  status code
+ *            - 0 every step replayed, no mismatch
+ *            - 1 steps left or mismatches seen
+ *            - 2 pMock is NULL
+ * @note      none
+ */
+uint8_t sht40x_mock_verify(sht40x_mock_t *const pMock);
+
+/**
+ * @brief  mock i2c bus init
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @return status code
+ *         - 0 success
+ *         - 1 pBus is NULL
+ * @note   none
+ */
+uint8_t sht40x_mock_i2c_init(void *pBus);
+
+/**
+ * @brief mock i2c bus deinit
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @return status code
+ *          - 0 success
+ *          - 1 pBus is NULL
+ */
+uint8_t sht40x_mock_i2c_deinit(void *pBus);
+
+/**
+ * @brief      mock i2c bus read
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scripted NACK or transfer not matching the script
+ * @note       none
+ */
+uint8_t sht40x_mock_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      mock i2c bus write
+ * @param[in]  pBus points to a sht40x_mock_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scripted NACK or transfer not matching the script
+ * @note       none
+ */
+uint8_t sht40x_mock_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_MOCK_H_INCLUDED
@@ -0,0 +1,326 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_mux.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 08:55 PM
+ */
+
+#include "sht40x_driver_mux.h"
+
+/**
+* @brief This function writes the control register of a switch
+* @param[in] *pMux points to the switch structure
+* @param[in] u8Control is the channel mask
+* @return status code
+*          - 0 success
+*          - 1 write failed
+* @note none
+*/
+static uint8_t a_sht40x_mux_write(sht40x_mux_t *const pMux, uint8_t u8Control)
+{
+    pMux->switches++;
+    if(pMux->i2c_write(pMux->pBus, pMux->address, &u8Control, 1) != 0)
+    {
+        pMux->known = 0;        /**< state of the switch unknown, written again next time */
+        return 1;
+    }
+    pMux->selected = u8Control;
+    pMux->known = 1;
+
+    return 0;
+}
+
+/**
+* @brief This function gets the port of a handle behind a switch
+* @param[in] *pHandle points to sht40x handle structure
+* @return port, NULL when the handle is not linked to the sht40x_mux_i2c_* functions
+* @note none
+*/
+static const sht40x_mux_port_t *a_sht40x_mux_port(const sht40x_handle_t *pHandle)
+{
+    if((pHandle == NULL) || (pHandle->i2c_write != sht40x_mux_i2c_write))
+        return NULL;
+    return (const sht40x_mux_port_t *)pHandle->i2c_bus;
+}
+
+/**
+* @brief This function compares the visiting rank of two handles
+* @param[in] *pA points to the first handle
+* @param[in] *pB points to the second handle
+* @return 1 when pA is visited after pB, 0 otherwise
+* @note direct handles first, then by switch, then by channel
+*/
+static uint8_t a_sht40x_mux_after(const sht40x_handle_t *pA, const sht40x_handle_t *pB)
+{
+    const sht40x_mux_port_t *pPortA = a_sht40x_mux_port(pA);
+    const sht40x_mux_port_t *pPortB = a_sht40x_mux_port(pB);
+
+    if(pPortA == NULL)
+        return 0;
+    if(pPortB == NULL)
+        return 1;
+    if(pPortA->pMux != pPortB->pMux)
+        return ((uintptr_t)pPortA->pMux > (uintptr_t)pPortB->pMux) ? 1 : 0;
+    return (pPortA->channel > pPortB->channel) ? 1 : 0;
+}
+
+/**
+ * @brief     This function initializes a switch
+ * @param[in] *pMux points to the switch structure
+ * @param[in] *pBus is the upstream bus
+ * @param[in] i2c_read is the upstream i2c read function
+ * @param[in] i2c_write is the upstream i2c write function
+ * @param[in] u8Address is the switch address, 0x70 .. 0x77
+ * @return  status code
+ *            - 0 success
+ *            - 1 address out of range
+ *            - 2 a pointer is NULL
+ * @note      the upstream bus is initialized by the caller, the first transfer selects its channel
+ */
+uint8_t sht40x_mux_init(sht40x_mux_t *const pMux, void *pBus, uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len),
+                        uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len), uint8_t u8Address)
+{
+    if((pMux == NULL) || (i2c_read == NULL) || (i2c_write == NULL))
+        return 2;
+    if((u8Address < SHT40X_MUX_ADDRESS_MIN) || (u8Address > SHT40X_MUX_ADDRESS_MAX))
+        return 1;
+
+    memset(pMux, 0, sizeof(sht40x_mux_t));
+    pMux->pBus = pBus;
+    pMux->i2c_read = i2c_read;
+    pMux->i2c_write = i2c_write;
+    pMux->address = u8Address;
+
+    return 0;
+}
+
+/**
+ * @brief     This function declares switches sharing one upstream bus
+ * @param[in] *pMuxes is an array of u8Count initialized switches
+ * @param[in] u8Count is the number of switches
+ * @return  status code
+ *            - 0 success
+ *            - 2 pMuxes is NULL or u8Count is 0
+ * @note      selecting a channel then disconnects the other switches first, sensors sharing an
+ *            address behind two switches are never connected together
+ */
+uint8_t sht40x_mux_share_bus(sht40x_mux_t *const pMuxes[], uint8_t u8Count)
+{
+    uint8_t index;
+
+    if((pMuxes == NULL) || (u8Count == 0))
+        return 2;
+
+    for(index = 0; index < u8Count; index++)
+    {
+        pMuxes[index]->pNext = (u8Count == 1) ? NULL : pMuxes[(index + 1) % u8Count];
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     This function initializes a port
+ * @param[in] *pPort points to the port structure
+ * @param[in] *pMux points to the switch
+ * @param[in] u8Channel is the downstream channel, 0 .. 7
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel out of range
+ *            - 2 a pointer is NULL
+ * @note      link the port with DRIVER_SHT40X_LINK_I2C_BUS and the sht40x_mux_i2c_* functions
+ */
+uint8_t sht40x_mux_port_init(sht40x_mux_port_t *const pPort, sht40x_mux_t *const pMux, uint8_t u8Channel)
+{
+    if((pPort == NULL) || (pMux == NULL))
+        return 2;
+    if(u8Channel >= SHT40X_MUX_CHANNELS)
+        return 1;
+
+    pPort->pMux = pMux;
+    pPort->channel = u8Channel;
+
+    return 0;
+}
+
+/**
+ * @brief     This function connects one channel
+ * @param[in] *pMux points to the switch structure
+ * @param[in] u8Channel is the downstream channel, 0 .. 7
+ * @return  status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 pMux is NULL
+ * @note      nothing is written when the channel is already the only one connected, the other
+ *            switches of the bus are released first
+ */
+uint8_t sht40x_mux_select(sht40x_mux_t *const pMux, uint8_t u8Channel)
+{
+    sht40x_mux_t *pPeer;
+    uint8_t u8Control = (uint8_t)(1U << (u8Channel & (SHT40X_MUX_CHANNELS - 1U)));
+
+    if(pMux == NULL)
+        return 2;
+    if((pMux->known == 1) && (pMux->selected == u8Control))
+        return 0;       /**< already connected */
+
+    for(pPeer = pMux->pNext; (pPeer != NULL) && (pPeer != pMux); pPeer = pPeer->pNext)
+    {
+        if(((pPeer->known == 0) || (pPeer->selected != 0)) && (a_sht40x_mux_write(pPeer, 0) != 0))
+            return 1;   /**< a channel of another switch may still be connected */
+    }
+
+    return a_sht40x_mux_write(pMux, u8Control);
+}
+
+/**
+ * @brief     This function disconnects every channel
+ * @param[in] *pMux points to the switch structure
+ * @return  status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 pMux is NULL
+ * @note      none
+ */
+uint8_t sht40x_mux_release(sht40x_mux_t *const pMux)
+{
+    if(pMux == NULL)
+        return 2;
+
+    return a_sht40x_mux_write(pMux, 0);
+}
+
+/**
+ * @brief     This function reads a group of sensors in one round, one channel after another
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      the sensors are grouped by switch and channel, every sensor of a channel is started
+ *            before the next channel is selected, then the channels are read back in reverse.
+ *            A round over C channels costs 2C - 1 selects at most, plus one release each time
+ *            the round moves to another switch of the bus. Handles not behind a
+ *            switch are visited first.
+ */
+uint8_t sht40x_mux_group_get_temp_rh(sht40x_handle_t *const pHandles[], uint8_t u8Count, sht40x_precision_t precision,
+                                     sht40x_data_t *pData, uint8_t *pStatus)
+{
+    uint8_t pOrder[255];
+    uint8_t index;
+    uint8_t slot;
+
+    if((pHandles == NULL) || (pData == NULL) || (u8Count == 0))
+        return 2;
+
+    for(index = 0; index < u8Count; index++)
+    {
+        slot = index;       /**< stable insertion sort, the array order is kept inside a channel */
+        while((slot > 0) && (a_sht40x_mux_after(pHandles[pOrder[slot - 1]], pHandles[index]) == 1))
+        {
+            pOrder[slot] = pOrder[slot - 1];
+            slot--;
+        }
+        pOrder[slot] = index;
+    }
+
+    return sht40x_group_get_temp_rh_ordered(pHandles, u8Count, pOrder, precision, pData, pStatus);
+}
+
+/**
+ * @brief     i2c bus init function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid port
+ * @note      the upstream bus is not touched
+ */
+uint8_t sht40x_mux_i2c_init(void *pBus)
+{
+    sht40x_mux_port_t *pPort = (sht40x_mux_port_t *)pBus;
+
+    if((pPort == NULL) || (pPort->pMux == NULL))
+        return 1;
+
+    return 0;
+}
+
+/**
+ * @brief     i2c bus deinit function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @return  status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t sht40x_mux_i2c_deinit(void *pBus)
+{
+    (void)pBus;
+
+    return 0;
+}
+
+/**
+ * @brief     i2c read function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @param[in] addr is the sensor address
+ * @param[out] *pBuf points to the data read
+ * @param[in] u8Length is the number of bytes to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel select or read failed
+ * @note      selects the port channel first when needed
+ */
+uint8_t sht40x_mux_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_mux_port_t *pPort = (sht40x_mux_port_t *)pBus;
+
+    if(sht40x_mux_select(pPort->pMux, pPort->channel) != 0)
+        return 1;
+
+    return pPort->pMux->i2c_read(pPort->pMux->pBus, addr, pBuf, u8Length);
+}
+
+/**
+ * @brief     i2c write function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @param[in] addr is the sensor address
+ * @param[in] *pBuf points to the data to write
+ * @param[in] u8Length is the number of bytes to write
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel select or write failed
+ * @note      selects the port channel first when needed
+ */
+uint8_t sht40x_mux_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_mux_port_t *pPort = (sht40x_mux_port_t *)pBus;
+
+    if(sht40x_mux_select(pPort->pMux, pPort->channel) != 0)
+        return 1;
+
+    return pPort->pMux->i2c_write(pPort->pMux->pBus, addr, pBuf, u8Length);
+}
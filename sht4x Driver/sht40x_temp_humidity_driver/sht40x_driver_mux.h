@@ -0,0 +1,202 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_mux.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 08:55 PM
+ */
+
+#ifndef SHT40X_DRIVER_MUX_H_INCLUDED
+#define SHT40X_DRIVER_MUX_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_mux_driver sht40x i2c multiplexer function
+ * @brief    TCA9548A style 8 channel i2c switch between the bus and the sensors
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_MUX_CHANNELS             8U              /**< downstream channels of one switch */
+#define SHT40X_MUX_ADDRESS_MIN          0x70U           /**< TCA9548A address, A2..A0 low */
+#define SHT40X_MUX_ADDRESS_MAX          0x77U           /**< TCA9548A address, A2..A0 high */
+
+/**
+* @brief sht40x i2c switch structure definition
+*/
+typedef struct sht40x_mux_s
+{
+    void *pBus;                                                       /**< upstream bus, given to i2c_read / i2c_write */
+    uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);    /**< upstream i2c read function */
+    uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len);   /**< upstream i2c write function */
+    uint8_t address;                                                  /**< switch 7 bit address */
+    uint8_t selected;                                                 /**< control register value last written */
+    uint8_t known;                                                    /**< selected matches the switch, cleared on a failed write */
+    uint32_t switches;                                                /**< control register writes */
+    struct sht40x_mux_s *pNext;                                       /**< next switch on the same upstream bus, circular, NULL when alone */
+} sht40x_mux_t;
+
+/**
+* @brief sht40x switch port structure definition, the i2c_bus of a handle behind a switch
+*/
+typedef struct sht40x_mux_port_s
+{
+    sht40x_mux_t *pMux;                                               /**< switch the sensor is behind */
+    uint8_t channel;                                                  /**< downstream channel, 0 .. 7 */
+} sht40x_mux_port_t;
+
+/**
+ * @brief     This function initializes a switch
+ * @param[in] *pMux points to the switch structure
+ * @param[in] *pBus is the upstream bus
+ * @param[in] i2c_read is the upstream i2c read function
+ * @param[in] i2c_write is the upstream i2c write function
+ * @param[in] u8Address is the switch address, 0x70 .. 0x77
+ * @return  status code
+ *            - 0 success
+ *            - 1 address out of range
+ *            - 2 a pointer is NULL
+ * @note      the upstream bus is initialized by the caller, the first transfer selects its channel
+ */
+uint8_t sht40x_mux_init(sht40x_mux_t *const pMux, void *pBus, uint8_t (*i2c_read)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len),
+                        uint8_t (*i2c_write)(void *bus, uint8_t addr, uint8_t *buf, uint8_t len), uint8_t u8Address);
+
+/**
+ * @brief     This function declares switches sharing one upstream bus
+ * @param[in] *pMuxes is an array of u8Count initialized switches
+ * @param[in] u8Count is the number of switches
+ * @return  status code
+ *            - 0 success
+ *            - 2 pMuxes is NULL or u8Count is 0
+ * @note      selecting a channel then disconnects the other switches first, sensors sharing an
+ *            address behind two switches are never connected together
+ */
+uint8_t sht40x_mux_share_bus(sht40x_mux_t *const pMuxes[], uint8_t u8Count);
+
+/**
+ * @brief     This function initializes a port
+ * @param[in] *pPort points to the port structure
+ * @param[in] *pMux points to the switch
+ * @param[in] u8Channel is the downstream channel, 0 .. 7
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel out of range
+ *            - 2 a pointer is NULL
+ * @note      link the port with DRIVER_SHT40X_LINK_I2C_BUS and the sht40x_mux_i2c_* functions
+ */
+uint8_t sht40x_mux_port_init(sht40x_mux_port_t *const pPort, sht40x_mux_t *const pMux, uint8_t u8Channel);
+
+/**
+ * @brief     This function connects one channel
+ * @param[in] *pMux points to the switch structure
+ * @param[in] u8Channel is the downstream channel, 0 .. 7
+ * @return  status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 pMux is NULL
+ * @note      nothing is written when the channel is already the only one connected, the other
+ *            switches of the bus are released first
+ */
+uint8_t sht40x_mux_select(sht40x_mux_t *const pMux, uint8_t u8Channel);
+
+/**
+ * @brief     This function disconnects every channel
+ * @param[in] *pMux points to the switch structure
+ * @return  status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 pMux is NULL
+ * @note      none
+ */
+uint8_t sht40x_mux_release(sht40x_mux_t *const pMux);
+
+/**
+ * @brief     This function reads a group of sensors in one round, one channel after another
+ * @param[in] *pHandles is an array of u8Count pointers to sht40x pHandle structures
+ * @param[in] u8Count is the number of sensors in the group
+ * @param[in] precision is the data read accuracy
+ * @param[out] pData is an array of u8Count sensor data, one per handle
+ * @param[out] pStatus is an array of u8Count status codes, one per handle (may be NULL)
+ * @return  status code
+ *            - 0 success
+ *            - 1 at least one sensor failed, see pStatus
+ *            - 2 pHandles is NULL or u8Count is 0
+ * @note      the sensors are grouped by switch and channel, every sensor of a channel is started
+ *            before the next channel is selected, then the channels are read back in reverse.
+ *            A round over C channels costs 2C - 1 selects at most, plus one release each time
+ *            the round moves to another switch of the bus. Handles not behind a
+ *            switch are visited first.
+ */
+uint8_t sht40x_mux_group_get_temp_rh(sht40x_handle_t *const pHandles[], uint8_t u8Count, sht40x_precision_t precision,
+                                     sht40x_data_t *pData, uint8_t *pStatus);
+
+/**
+ * @brief     i2c bus init function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid port
+ * @note      the upstream bus is not touched
+ */
+uint8_t sht40x_mux_i2c_init(void *pBus);
+
+/**
+ * @brief     i2c bus deinit function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @return  status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t sht40x_mux_i2c_deinit(void *pBus);
+
+/**
+ * @brief     i2c read function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @param[in] addr is the sensor address
+ * @param[out] *pBuf points to the data read
+ * @param[in] u8Length is the number of bytes to read
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel select or read failed
+ * @note      selects the port channel first when needed
+ */
+uint8_t sht40x_mux_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief     i2c write function of a sensor behind a switch
+ * @param[in] *pBus points to a sht40x_mux_port_t
+ * @param[in] addr is the sensor address
+ * @param[in] *pBuf points to the data to write
+ * @param[in] u8Length is the number of bytes to write
+ * @return  status code
+ *            - 0 success
+ *            - 1 channel select or write failed
+ * @note      selects the port channel first when needed
+ */
+uint8_t sht40x_mux_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_MUX_H_INCLUDED
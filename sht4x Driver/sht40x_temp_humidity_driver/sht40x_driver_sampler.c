@@ -0,0 +1,324 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_sampler.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 10:05 AM
+ */
+
+#include "sht40x_driver_sampler.h"
+#include "sht40x_driver_filter.h"
+
+/**
+ * @brief     This function initializes a sample ring
+ * @param[in] *pRing points to the ring structure
+ * @param[in] *pBuffer points to the caller provided sample storage
+ * @param[in] u16Size is the number of samples in pBuffer, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pRing or pBuffer is NULL
+ * @note      none
+ */
+uint8_t sht40x_ring_init(sht40x_ring_t *const pRing, sht40x_sample_t *pBuffer, uint16_t u16Size)
+{
+    if((pRing == NULL) || (pBuffer == NULL))
+        return 2;     /**< return failed error */
+
+    if((u16Size == 0) || ((u16Size & (u16Size - 1)) != 0) || (u16Size > 0x8000))
+        return 1;     /**< free running 16-bit indexes need a power of two size */
+
+    pRing->pBuffer = pBuffer;
+    pRing->mask = u16Size - 1;
+    pRing->head = 0;
+    pRing->tail = 0;
+    pRing->overflow = 0;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function stores a sample, producer side
+ * @param[in] *pRing points to the ring structure
+ * @param[in] *pSample points to the sample to store
+ * @return  status code
+ *            - 0 success
+ *            - 1 ring full, sample dropped and counted
+ * @note      never blocks, safe against a concurrent sht40x_ring_pop
+ */
+uint8_t sht40x_ring_push(sht40x_ring_t *const pRing, const sht40x_sample_t *pSample)
+{
+    uint16_t u16Head = pRing->head;
+
+    if((uint16_t)(u16Head - pRing->tail) > pRing->mask)
+    {
+        pRing->overflow++;
+        return 1;       /**< full */
+    }
+
+    pRing->pBuffer[u16Head & pRing->mask] = *pSample;
+    SHT40X_RING_BARRIER();                  /**< sample visible before the index moves */
+    pRing->head = u16Head + 1;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function takes the oldest sample, consumer side
+ * @param[in] *pRing points to the ring structure
+ * @param[out] *pSample points to the sample read
+ * @return  status code
+ *            - 0 success
+ *            - 1 ring empty
+ * @note      never blocks, safe against a concurrent sht40x_ring_push
+ */
+uint8_t sht40x_ring_pop(sht40x_ring_t *const pRing, sht40x_sample_t *pSample)
+{
+    uint16_t u16Tail = pRing->tail;
+
+    if(u16Tail == pRing->head)
+        return 1;       /**< empty */
+
+    SHT40X_RING_BARRIER();                  /**< index read before the sample */
+    *pSample = pRing->pBuffer[u16Tail & pRing->mask];
+    SHT40X_RING_BARRIER();                  /**< sample copied before the slot is released */
+    pRing->tail = u16Tail + 1;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function get the number of samples waiting in the ring
+ * @param[in] *pRing points to the ring structure
+ * @return    number of samples
+ * @note      none
+ */
+uint16_t sht40x_ring_count(sht40x_ring_t *const pRing)
+{
+    return (uint16_t)(pRing->head - pRing->tail);
+}
+
+/**
+ * @brief     This function initializes a continuous sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] *pHandle points to an initialized sht40x pHandle structure
+ * @param[in] *pRing points to the ring receiving the samples
+ * @param[in] precision is the data read accuracy
+ * @param[in] u32Period_ms is the time between two measurements
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid precision
+ *            - 2 a pointer is NULL
+ *            - 3 pHandle is not initialized
+ * @note      the period is raised to the conversion time of the precision if shorter
+ */
+uint8_t sht40x_sampler_init(sht40x_sampler_t *const pSampler, sht40x_handle_t *const pHandle, sht40x_ring_t *const pRing,
+                            sht40x_precision_t precision, uint32_t u32Period_ms)
+{
+    uint8_t err;
+    uint8_t u8Conversion;
+
+    if((pSampler == NULL) || (pRing == NULL))
+        return 2;     /**< return failed error */
+
+    err = sht40x_get_conversion_time(pHandle, precision, &u8Conversion);
+    if(err != SHT40X_DRV_OK)
+        return err;     /**< invalid handle or precision */
+
+    memset(pSampler, 0, sizeof(sht40x_sampler_t));
+    pSampler->pHandle = pHandle;
+    pSampler->pRing = pRing;
+    pSampler->precision = precision;
+    pSampler->period_ms = u32Period_ms < u8Conversion ? u8Conversion : u32Period_ms;
+    pSampler->state = SHT40X_SAMPLER_STOPPED;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function attaches a streaming filter to the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] *pFilter points to an initialized filter, NULL to store raw samples
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      only the filter outputs are stored in the ring, a boxcar of N with a period
+ *            equal to the conversion time decimates N back to back measurements into one
+ */
+uint8_t sht40x_sampler_set_filter(sht40x_sampler_t *const pSampler, struct sht40x_filter_s *pFilter)
+{
+    if(pSampler == NULL)
+        return 2;     /**< return failed error */
+
+    pSampler->pFilter = pFilter;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function starts the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] u32Now_ms is the current tick, the first measurement starts at the next tick call
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      none
+ */
+uint8_t sht40x_sampler_start(sht40x_sampler_t *const pSampler, uint32_t u32Now_ms)
+{
+    if(pSampler == NULL)
+        return 2;     /**< return failed error */
+
+    pSampler->next_tick = u32Now_ms;
+    pSampler->state = SHT40X_SAMPLER_IDLE;
+#if defined(SHT40X_SAMPLE_DELTA) || defined(SHT40X_SAMPLE_FLAGS)
+    pSampler->stored_tick = u32Now_ms;          /**< the first delta counts from here */
+    pSampler->flags = SHT40X_SAMPLE_FLAG_FIRST;
+#endif // SHT40X_SAMPLE_DELTA || SHT40X_SAMPLE_FLAGS
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function stops the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      a running conversion is abandoned
+ */
+uint8_t sht40x_sampler_stop(sht40x_sampler_t *const pSampler)
+{
+    if(pSampler == NULL)
+        return 2;     /**< return failed error */
+
+    pSampler->state = SHT40X_SAMPLER_STOPPED;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function advances the sampler state machine
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] u32Now_ms is the current tick in milliseconds
+ * @return  status code
+ *            - 0 nothing to do or step done
+ *            - 1 the measurement step failed, counted in errors
+ *            - 2 pSampler is NULL
+ * @note      call from a periodic timer callback or the main loop, at least once per
+ *            millisecond for accurate timing. Each call performs at most one i2c transfer
+ *            and never waits.
+ */
+uint8_t sht40x_sampler_tick(sht40x_sampler_t *const pSampler, uint32_t u32Now_ms)
+{
+    uint8_t err;
+    uint8_t u8Conversion;
+    sht40x_ticks_t ticks;
+    sht40x_sample_t sample;
+    sht40x_sample_t filtered;
+
+    if(pSampler == NULL)
+        return 2;     /**< return failed error */
+
+    switch(pSampler->state)
+    {
+        case SHT40X_SAMPLER_IDLE:
+        {
+            if((int32_t)(u32Now_ms - pSampler->next_tick) < 0)
+                break;      /**< not due yet */
+
+            pSampler->next_tick += pSampler->period_ms;
+            if((int32_t)(u32Now_ms - pSampler->next_tick) >= 0)
+                pSampler->next_tick = u32Now_ms + pSampler->period_ms;     /**< fell behind, re-align instead of bursting */
+
+            err = sht40x_start_measurement(pSampler->pHandle, (sht40x_precision_t)pSampler->precision);
+            if(err != SHT40X_DRV_OK)
+            {
+                pSampler->errors++;
+                return 1;   /**< failed */
+            }
+            (void)sht40x_get_conversion_time(pSampler->pHandle, (sht40x_precision_t)pSampler->precision, &u8Conversion);
+            pSampler->start_tick = u32Now_ms;
+            pSampler->ready_tick = u32Now_ms + u8Conversion;
+            pSampler->state = SHT40X_SAMPLER_CONVERTING;
+            break;
+        }
+
+        case SHT40X_SAMPLER_CONVERTING:
+        {
+            if((int32_t)(u32Now_ms - pSampler->ready_tick) < 0)
+                break;      /**< conversion still running */
+
+            err = sht40x_fetch_ticks(pSampler->pHandle, &ticks);      /**< conversion is left to the consumer */
+            if(err == SHT40X_DRV_NOT_READY)
+            {
+                pSampler->ready_tick = u32Now_ms + MEASUREMENT_POLL_DELAY;      /**< busy NACK, try again a little later */
+                break;
+            }
+
+            pSampler->state = SHT40X_SAMPLER_IDLE;
+            if(err != SHT40X_DRV_OK)
+            {
+                pSampler->errors++;
+                return 1;   /**< failed */
+            }
+
+            sample.temperature = ticks.temperature;
+            sample.humidity = ticks.humidity;
+            if(pSampler->pFilter != NULL)
+            {
+                if(sht40x_filter_push(pSampler->pFilter, &sample, &filtered) != SHT40X_DRV_OK)
+                    break;      /**< filter has no output for this sample */
+                sample = filtered;
+            }
+#ifdef SHT40X_SAMPLE_DELTA
+            sample.delta_ms = ((pSampler->start_tick - pSampler->stored_tick) > 0xFFFFUL) ? 0xFFFFU : (uint16_t)(pSampler->start_tick - pSampler->stored_tick);
+            if(sample.delta_ms == 0xFFFFU)
+                pSampler->flags |= SHT40X_SAMPLE_FLAG_GAP;
+#endif // SHT40X_SAMPLE_DELTA
+#ifdef SHT40X_SAMPLE_FLAGS
+            sample.flags = pSampler->flags;
+#endif // SHT40X_SAMPLE_FLAGS
+#if defined(SHT40X_SAMPLE_DELTA) || defined(SHT40X_SAMPLE_FLAGS)
+            if(sht40x_ring_push(pSampler->pRing, &sample) != 0)
+            {
+                pSampler->flags = (pSampler->flags & SHT40X_SAMPLE_FLAG_FIRST) | SHT40X_SAMPLE_FLAG_LOST;    /**< the next stored delta spans the dropped one */
+                break;
+            }
+            pSampler->stored_tick = pSampler->start_tick;
+            pSampler->flags = 0;
+#else
+            (void)sht40x_ring_push(pSampler->pRing, &sample);       /**< a full ring counts the overflow */
+#endif // SHT40X_SAMPLE_DELTA || SHT40X_SAMPLE_FLAGS
+            break;
+        }
+
+        default:
+        {
+            break;      /**< stopped */
+        }
+    }
+
+    return 0;   /**< success */
+}
+
+/* end */
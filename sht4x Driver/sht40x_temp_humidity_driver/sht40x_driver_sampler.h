@@ -0,0 +1,297 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_sampler.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 10:05 AM
+ */
+
+#ifndef SHT40X_DRIVER_SAMPLER_H_INCLUDED
+#define SHT40X_DRIVER_SAMPLER_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+/**
+ * @defgroup sht40x_sampler_driver sht40x continuous sampling function
+ * @brief    sht40x continuous sampling modules
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+ * @brief memory barrier between the ring data and its indexes
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__))
+#define SHT40X_RING_BARRIER()       __sync_synchronize()
+#elif defined(__GNUC__)
+#define SHT40X_RING_BARRIER()       __asm__ volatile("" ::: "memory")
+#else
+#define SHT40X_RING_BARRIER()
+#endif
+
+#define SHT40X_SAMPLE_FLAG_FIRST        0x01U           /**< first sample since sht40x_sampler_start, delta counts from the start */
+#define SHT40X_SAMPLE_FLAG_LOST         0x02U           /**< samples were dropped on a full ring before this one */
+#define SHT40X_SAMPLE_FLAG_GAP          0x04U           /**< delta saturated at 0xFFFF ms */
+
+/**
+* @brief sht40x compact sample structure definition
+* @note  4 bytes, 6 with SHT40X_SAMPLE_DELTA or SHT40X_SAMPLE_FLAGS, 8 with both
+*/
+typedef struct sht40x_sample_s
+{
+    uint16_t temperature;                                             /**< raw temperature ticks */
+    uint16_t humidity;                                                /**< raw humidity ticks */
+#ifdef SHT40X_SAMPLE_DELTA
+    uint16_t delta_ms;                                                /**< measurement start minus the previous stored one (ms) */
+#endif // SHT40X_SAMPLE_DELTA
+#ifdef SHT40X_SAMPLE_FLAGS
+    uint8_t flags;                                                    /**< SHT40X_SAMPLE_FLAG_* */
+#endif // SHT40X_SAMPLE_FLAGS
+} sht40x_sample_t;
+
+/**
+ * @brief     This function gets the temperature of a sample
+ * @param[in] *pSample points to the sample
+ * @return    temperature in milli degree Celsius
+ * @note      none
+ */
+static inline int32_t sht40x_sample_temperature_mC(const sht40x_sample_t *pSample)
+{
+    return sht40x_convert_temperature_mC(pSample->temperature);
+}
+
+/**
+ * @brief     This function gets the temperature of a sample
+ * @param[in] *pSample points to the sample
+ * @return    temperature in milli degree Fahrenheit
+ * @note      none
+ */
+static inline int32_t sht40x_sample_temperature_mF(const sht40x_sample_t *pSample)
+{
+    return sht40x_convert_temperature_mF(pSample->temperature);
+}
+
+/**
+ * @brief     This function gets the humidity of a sample
+ * @param[in] *pSample points to the sample
+ * @return    clamped relative humidity in milli percent
+ * @note      none
+ */
+static inline int32_t sht40x_sample_humidity_mRH(const sht40x_sample_t *pSample)
+{
+    return sht40x_convert_humidity_mRH(pSample->humidity);
+}
+
+#ifndef SHT40X_FIXED_POINT
+/**
+ * @brief     This function gets the temperature of a sample
+ * @param[in] *pSample points to the sample
+ * @return    temperature in degree Celsius
+ * @note      same formula as sht40x_get_temp_rh
+ */
+static inline float sht40x_sample_temperature_C(const sht40x_sample_t *pSample)
+{
+    return ((pSample->temperature / 65535.0f) * 175.0f) - 45.0f;
+}
+
+/**
+ * @brief     This function gets the temperature of a sample
+ * @param[in] *pSample points to the sample
+ * @return    temperature in degree Fahrenheit
+ * @note      same formula as sht40x_get_temp_rh
+ */
+static inline float sht40x_sample_temperature_F(const sht40x_sample_t *pSample)
+{
+    return (sht40x_sample_temperature_C(pSample) * 9.0f / 5.0f) + 32.0f;
+}
+
+/**
+ * @brief     This function gets the humidity of a sample
+ * @param[in] *pSample points to the sample
+ * @return    clamped relative humidity in percent
+ * @note      same formula as sht40x_get_temp_rh
+ */
+static inline float sht40x_sample_humidity(const sht40x_sample_t *pSample)
+{
+    float humidity = ((pSample->humidity / 65535.0f) * 125.0f) - 6.0f;
+
+    humidity = humidity > HUMIDITY_MAX ? HUMIDITY_MAX : humidity;
+    return humidity < HUMIDITY_MIN ? HUMIDITY_MIN : humidity;
+}
+#endif // SHT40X_FIXED_POINT
+
+/**
+* @brief sht40x single producer / single consumer sample ring structure definition
+* @note  head is only written by the producer, tail only by the consumer, no lock needed
+*/
+typedef struct sht40x_ring_s
+{
+    sht40x_sample_t *pBuffer;                                         /**< caller provided storage */
+    uint16_t mask;                                                    /**< ring size - 1, size is a power of two */
+    volatile uint16_t head;                                           /**< free running write index */
+    volatile uint16_t tail;                                           /**< free running read index */
+    volatile uint32_t overflow;                                       /**< samples dropped because the ring was full */
+} sht40x_ring_t;
+
+/**
+* @brief sht40x sampler state enumeration
+*/
+typedef enum
+{
+    SHT40X_SAMPLER_STOPPED    = 0x00,                                 /**< sampler is not running */
+    SHT40X_SAMPLER_IDLE       = 0x01,                                 /**< waiting for the next period */
+    SHT40X_SAMPLER_CONVERTING = 0x02                                  /**< measurement started, waiting for the conversion */
+} sht40x_sampler_state_t;
+
+/**
+* @brief sht40x continuous sampler structure definition
+*/
+typedef struct sht40x_sampler_s
+{
+    sht40x_handle_t *pHandle;                                         /**< sensor being sampled */
+    sht40x_ring_t *pRing;                                             /**< ring receiving the samples */
+    uint8_t precision;                                                /**< measurement precision */
+    uint8_t state;                                                    /**< sht40x_sampler_state_t */
+    uint32_t period_ms;                                               /**< time between two measurement starts */
+    uint32_t next_tick;                                               /**< tick of the next measurement start */
+    uint32_t ready_tick;                                              /**< tick at which the running conversion is done */
+    uint32_t start_tick;                                              /**< tick at which the running conversion started */
+    uint32_t errors;                                                  /**< measurements that failed */
+    struct sht40x_filter_s *pFilter;                                  /**< optional filter between the sensor and the ring */
+#if defined(SHT40X_SAMPLE_DELTA) || defined(SHT40X_SAMPLE_FLAGS)
+    uint32_t stored_tick;                                             /**< measurement start of the last stored sample */
+    uint8_t flags;                                                    /**< flags carried to the next stored sample */
+#endif // SHT40X_SAMPLE_DELTA || SHT40X_SAMPLE_FLAGS
+} sht40x_sampler_t;
+
+/**
+ * @brief     This function initializes a sample ring
+ * @param[in] *pRing points to the ring structure
+ * @param[in] *pBuffer points to the caller provided sample storage
+ * @param[in] u16Size is the number of samples in pBuffer, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pRing or pBuffer is NULL
+ * @note      none
+ */
+uint8_t sht40x_ring_init(sht40x_ring_t *const pRing, sht40x_sample_t *pBuffer, uint16_t u16Size);
+
+/**
+ * @brief     This function stores a sample, producer side
+ * @param[in] *pRing points to the ring structure
+ * @param[in] *pSample points to the sample to store
+ * @return  status code
+ *            - 0 success
+ *            - 1 ring full, sample dropped and counted
+ * @note      never blocks, safe against a concurrent sht40x_ring_pop
+ */
+uint8_t sht40x_ring_push(sht40x_ring_t *const pRing, const sht40x_sample_t *pSample);
+
+/**
+ * @brief     This function takes the oldest sample, consumer side
+ * @param[in] *pRing points to the ring structure
+ * @param[out] *pSample points to the sample read
+ * @return  status code
+ *            - 0 success
+ *            - 1 ring empty
+ * @note      never blocks, safe against a concurrent sht40x_ring_push
+ */
+uint8_t sht40x_ring_pop(sht40x_ring_t *const pRing, sht40x_sample_t *pSample);
+
+/**
+ * @brief     This function get the number of samples waiting in the ring
+ * @param[in] *pRing points to the ring structure
+ * @return    number of samples
+ * @note      none
+ */
+uint16_t sht40x_ring_count(sht40x_ring_t *const pRing);
+
+/**
+ * @brief     This function initializes a continuous sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] *pHandle points to an initialized sht40x pHandle structure
+ * @param[in] *pRing points to the ring receiving the samples
+ * @param[in] precision is the data read accuracy
+ * @param[in] u32Period_ms is the time between two measurements
+ * @return  status code
+ *            - 0 success
+ *            - 1 invalid precision
+ *            - 2 a pointer is NULL
+ *            - 3 pHandle is not initialized
+ * @note      the period is raised to the conversion time of the precision if shorter
+ */
+uint8_t sht40x_sampler_init(sht40x_sampler_t *const pSampler, sht40x_handle_t *const pHandle, sht40x_ring_t *const pRing,
+                            sht40x_precision_t precision, uint32_t u32Period_ms);
+
+/**
+ * @brief     This function attaches a streaming filter to the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] *pFilter points to an initialized filter, NULL to store raw samples
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      only the filter outputs are stored in the ring, a boxcar of N with a period
+ *            equal to the conversion time decimates N back to back measurements into one
+ */
+uint8_t sht40x_sampler_set_filter(sht40x_sampler_t *const pSampler, struct sht40x_filter_s *pFilter);
+
+/**
+ * @brief     This function starts the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] u32Now_ms is the current tick, the first measurement starts at the next tick call
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      none
+ */
+uint8_t sht40x_sampler_start(sht40x_sampler_t *const pSampler, uint32_t u32Now_ms);
+
+/**
+ * @brief     This function stops the sampler
+ * @param[in] *pSampler points to the sampler structure
+ * @return  status code
+ *            - 0 success
+ *            - 2 pSampler is NULL
+ * @note      a running conversion is abandoned
+ */
+uint8_t sht40x_sampler_stop(sht40x_sampler_t *const pSampler);
+
+/**
+ * @brief     This function advances the sampler state machine
+ * @param[in] *pSampler points to the sampler structure
+ * @param[in] u32Now_ms is the current tick in milliseconds
+ * @return  status code
+ *            - 0 nothing to do or step done
+ *            - 1 the measurement step failed, counted in errors
+ *            - 2 pSampler is NULL
+ * @note      call from a periodic timer callback or the main loop, at least once per
+ *            millisecond for accurate timing. Each call performs at most one i2c transfer
+ *            and never waits.
+ */
+uint8_t sht40x_sampler_tick(sht40x_sampler_t *const pSampler, uint32_t u32Now_ms);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_SAMPLER_H_INCLUDED
@@ -0,0 +1,392 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_sim.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 01:40 PM
+ */
+
+#include "sht40x_driver_sim.h"
+
+/* Heater power per HEATER_POWER pair (mW) */
+static uint8_t const SHT40X_SIM_HEATER_MW[3] = {200, 110, 20};
+
+/**
+* @brief This function finds a device by address
+* @param[in] *pBus points to the bus structure
+* @param[in] u8Address is the 7 bit i2c address
+* @return device, NULL when nothing answers at that address
+* @note none
+*/
+static sht40x_sim_device_t *a_sht40x_sim_find(sht40x_sim_bus_t *const pBus, uint8_t u8Address)
+{
+    uint8_t index;
+
+    for(index = 0; index < pBus->count; index++)
+    {
+        if((pBus->pDevices[index].address == u8Address) && (pBus->pDevices[index].present == 1))
+        {
+            return &pBus->pDevices[index];
+        }
+    }
+    return NULL;
+}
+
+/**
+* @brief This function accounts a transfer on the bus
+* @param[in] *pBus points to the bus structure
+* @param[in] u8Length is the number of data bytes after the address byte
+* @return none
+* @note start + address + data + stop, 9 clocks per byte, advances the internal clock
+*/
+static void a_sht40x_sim_transfer(sht40x_sim_bus_t *const pBus, uint8_t u8Length)
+{
+    uint32_t u32Bits = 2U + (9U * (1U + u8Length));
+    uint32_t u32Time_us = (uint32_t)(((uint64_t)u32Bits * 1000000ULL + pBus->bus_hz - 1U) / pBus->bus_hz);
+
+    pBus->transfers++;
+    pBus->bus_busy_us += u32Time_us;
+    if(pBus->now_us == NULL)
+    {
+        pBus->virtual_us += u32Time_us;
+    }
+}
+
+/**
+* @brief This function draws one noise sample
+* @param[in] *pDevice points to the device structure
+* @param[in] i32Peak is the peak amplitude
+* @return uniform value in [-i32Peak, i32Peak]
+* @note linear congruential generator, repeatable for a given seed
+*/
+static int32_t a_sht40x_sim_noise(sht40x_sim_device_t *const pDevice, int32_t i32Peak)
+{
+    pDevice->seed = (pDevice->seed * 1664525UL) + 1013904223UL;
+    if(i32Peak <= 0)
+    {
+        return 0;
+    }
+    return (int32_t)((pDevice->seed >> 8) % (uint32_t)((2 * i32Peak) + 1)) - i32Peak;
+}
+
+/**
+* @brief This function stores one word and its CRC in the response
+* @param[out] *pFrame points to the 3 bytes to fill
+* @param[in] u16Word is the word to store
+* @return none
+* @note none
+*/
+static void a_sht40x_sim_word(uint8_t *pFrame, uint16_t u16Word)
+{
+    pFrame[0] = (uint8_t)(u16Word >> 8);
+    pFrame[1] = (uint8_t)(u16Word & 0xFF);
+    pFrame[2] = sht40x_crc8(pFrame, 2);
+}
+
+/**
+* @brief This function converts a physical value to sensor ticks
+* @param[in] i32Value is the value in milli-units
+* @param[in] i32Offset is the offset of the sensor formula in milli-units
+* @param[in] i32Span is the span of the sensor formula in milli-units
+* @return ticks, saturated to the 16 bit range
+* @note inverse of value = -offset + span * ticks / 65535
+*/
+static uint16_t a_sht40x_sim_ticks(int32_t i32Value, int32_t i32Offset, int32_t i32Span)
+{
+    int64_t i64Ticks = (((int64_t)(i32Value + i32Offset) * 65535LL) + (i32Span / 2)) / i32Span;
+
+    if(i64Ticks < 0)
+        return 0;
+    if(i64Ticks > 65535)
+        return 65535;
+    return (uint16_t)i64Ticks;
+}
+
+/**
+* @brief This function prepares a measurement response
+* @param[in] *pDevice points to the device structure
+* @param[in] u64At_us is the time the measurement is taken
+* @param[in] u8Scale is the noise scale in halves (2 high, 3 medium, 4 lowest precision)
+* @param[in] i32Rise_mC is the heater temperature rise
+* @return none
+* @note none
+*/
+static void a_sht40x_sim_measure(sht40x_sim_device_t *const pDevice, uint64_t u64At_us, uint8_t u8Scale, int32_t i32Rise_mC)
+{
+    int64_t i64At_us = (int64_t)u64At_us;
+    int32_t i32Temperature;
+    int32_t i32Humidity;
+
+    i32Temperature = pDevice->temperature_mC + (int32_t)(((int64_t)pDevice->drift_mC_per_s * i64At_us) / 1000000LL);
+    i32Humidity = pDevice->humidity_mRH + (int32_t)(((int64_t)pDevice->drift_mRH_per_s * i64At_us) / 1000000LL);
+    i32Temperature += a_sht40x_sim_noise(pDevice, (pDevice->noise_mC * u8Scale) / 2) + i32Rise_mC;
+    i32Humidity += a_sht40x_sim_noise(pDevice, (pDevice->noise_mRH * u8Scale) / 2);
+
+    a_sht40x_sim_word(&pDevice->response[0], a_sht40x_sim_ticks(i32Temperature, 45000L, 175000L));
+    a_sht40x_sim_word(&pDevice->response[3], a_sht40x_sim_ticks(i32Humidity, 6000L, 125000L));
+}
+
+/**
+ * @brief     This function initializes a virtual device with room conditions and datasheet timing
+ * @param[in] *pDevice points to the device structure
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u32Serial is the serial number
+ * @return  status code
+ *            - 0 success
+ *            - 2 pDevice is NULL
+ * @note      25 C, 50 %RH, no noise, no drift; adjust the fields afterwards
+ */
+uint8_t sht40x_sim_device_init(sht40x_sim_device_t *const pDevice, uint8_t u8Address, uint32_t u32Serial)
+{
+    if(pDevice == NULL)
+        return 2;     /**< return failed error */
+
+    memset(pDevice, 0, sizeof(sht40x_sim_device_t));
+    pDevice->address = u8Address;
+    pDevice->present = 1;
+    pDevice->serial = u32Serial;
+    pDevice->temperature_mC = 25000L;
+    pDevice->humidity_mRH = 50000L;
+    pDevice->heater_rise_mC = 20000L;
+    pDevice->conversion_us[SHT40X_PRECISION_HIGH] = SHT40X_SIM_CONVERSION_HIGH_US;
+    pDevice->conversion_us[SHT40X_PRECISION_MIDIUM] = SHT40X_SIM_CONVERSION_MEDIUM_US;
+    pDevice->conversion_us[SHT40X_PRECISION_LOWEST] = SHT40X_SIM_CONVERSION_LOWEST_US;
+    pDevice->seed = u32Serial;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function initializes a virtual bus
+ * @param[in] *pBus points to the bus structure
+ * @param[in] *pDevices points to the devices on the bus
+ * @param[in] u8Count is the number of devices
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      uses the internal virtual clock until now_us is set
+ */
+uint8_t sht40x_sim_bus_init(sht40x_sim_bus_t *const pBus, sht40x_sim_device_t *pDevices, uint8_t u8Count)
+{
+    if(pBus == NULL)
+        return 2;     /**< return failed error */
+
+    memset(pBus, 0, sizeof(sht40x_sim_bus_t));
+    pBus->pDevices = pDevices;
+    pBus->count = (pDevices == NULL) ? 0 : u8Count;
+    pBus->bus_hz = SHT40X_SIM_BUS_HZ;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function advances the internal virtual clock
+ * @param[in] *pBus points to the bus structure
+ * @param[in] u32Us is the time to add in microseconds
+ * @return    none
+ * @note      call it from the delay function linked to the handle, ignored with an external clock
+ */
+void sht40x_sim_advance_us(sht40x_sim_bus_t *const pBus, uint32_t u32Us)
+{
+    if((pBus != NULL) && (pBus->now_us == NULL))
+    {
+        pBus->virtual_us += u32Us;
+    }
+}
+
+/**
+ * @brief     This function returns the current time of a virtual bus
+ * @param[in] *pBus points to the bus structure
+ * @return    time in microseconds
+ * @note      none
+ */
+uint64_t sht40x_sim_now_us(sht40x_sim_bus_t *const pBus)
+{
+    if(pBus->now_us != NULL)
+    {
+        return pBus->now_us(pBus->pContext);
+    }
+    return pBus->virtual_us;
+}
+
+/**
+ * @brief  virtual i2c bus init
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @return status code
+ *         - 0 success
+ *         - 1 pBus is NULL
+ * @note   none
+ */
+uint8_t sht40x_sim_i2c_init(void *pBus)
+{
+    return (pBus == NULL) ? 1 : 0;
+}
+
+/**
+ * @brief virtual i2c bus deinit
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @return status code
+ *          - 0 success
+ *          - 1 pBus is NULL
+ */
+uint8_t sht40x_sim_i2c_deinit(void *pBus)
+{
+    return (pBus == NULL) ? 1 : 0;
+}
+
+/**
+ * @brief      virtual i2c bus read
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 address NACKed: no device, device busy or no response pending
+ * @note       a response is delivered once, like the real device
+ */
+uint8_t sht40x_sim_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_sim_bus_t *pSim = (sht40x_sim_bus_t *)pBus;
+    sht40x_sim_device_t *pDevice;
+
+    if(pSim == NULL)
+        return 1;   /**< no bus linked */
+
+    pDevice = a_sht40x_sim_find(pSim, addr);
+    if((pDevice == NULL) || (pDevice->response_valid == 0) || (sht40x_sim_now_us(pSim) < pDevice->busy_until_us))
+    {
+        a_sht40x_sim_transfer(pSim, 0);
+        if(pDevice != NULL)
+            pDevice->nacks++;
+        return 1;   /**< address NACKed */
+    }
+
+    a_sht40x_sim_transfer(pSim, u8Length);
+    if(u8Length > RESPONSE_LENGTH)
+        u8Length = RESPONSE_LENGTH;     /**< the master reads 0xFF past the response, left untouched here */
+    memcpy(pBuf, pDevice->response, u8Length);
+    pDevice->response_valid = 0;
+    pDevice->reads++;
+
+    if((pDevice->crc_error_every != 0) && ((pDevice->reads % pDevice->crc_error_every) == 0) && (u8Length >= 3))
+    {
+        pBuf[2] ^= 0x01;    /**< injected transmission error */
+    }
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief      virtual i2c bus write
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to the command byte
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 NACKed: no device, device busy or unknown command
+ * @note       none
+ */
+uint8_t sht40x_sim_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_sim_bus_t *pSim = (sht40x_sim_bus_t *)pBus;
+    sht40x_sim_device_t *pDevice;
+    uint64_t u64Now;
+    uint32_t u32Busy_us = 0;
+    uint8_t u8Precision;
+    uint8_t u8Power;
+
+    if(pSim == NULL)
+        return 1;   /**< no bus linked */
+
+    pDevice = a_sht40x_sim_find(pSim, addr);
+    if((pDevice == NULL) || (sht40x_sim_now_us(pSim) < pDevice->busy_until_us))
+    {
+        a_sht40x_sim_transfer(pSim, 0);
+        if(pDevice != NULL)
+            pDevice->nacks++;
+        return 1;   /**< address NACKed */
+    }
+
+    a_sht40x_sim_transfer(pSim, u8Length);
+    if((u8Length == 0) || (pBuf == NULL))
+    {
+        return 0;   /**< address probe */
+    }
+
+    u64Now = sht40x_sim_now_us(pSim);
+    pDevice->response_valid = 0;
+
+    for(u8Precision = 0; u8Precision < 3; u8Precision++)
+    {
+        if(pBuf[0] == READ_PRECISION[u8Precision])
+        {
+            u32Busy_us = pDevice->conversion_us[u8Precision];
+            a_sht40x_sim_measure(pDevice, u64Now + u32Busy_us, (uint8_t)(2U + u8Precision), 0);
+            pDevice->response_valid = 1;
+        }
+    }
+
+    for(u8Power = 0; u8Power < 6; u8Power++)
+    {
+        if(pBuf[0] == HEATER_POWER[u8Power])
+        {
+            int32_t i32Rise = (pDevice->heater_rise_mC * SHT40X_SIM_HEATER_MW[u8Power / 2]) / 200;
+
+            if((u8Power & 1U) == 0)
+            {
+                u32Busy_us = SHT40X_SIM_HEATER_1S_US;
+            }
+            else
+            {
+                u32Busy_us = SHT40X_SIM_HEATER_100mS_US;
+                i32Rise /= 5;       /**< a short pulse heats the die less */
+            }
+            a_sht40x_sim_measure(pDevice, u64Now + u32Busy_us, 2, i32Rise);
+            pDevice->response_valid = 1;
+        }
+    }
+
+    if(pBuf[0] == SHT40X_READ_SERIAL_NUMBER_CMD)
+    {
+        u32Busy_us = SHT40X_SIM_SERIAL_US;
+        a_sht40x_sim_word(&pDevice->response[0], (uint16_t)(pDevice->serial >> 16));
+        a_sht40x_sim_word(&pDevice->response[3], (uint16_t)(pDevice->serial & 0xFFFF));
+        pDevice->response_valid = 1;
+    }
+    else if(pBuf[0] == SHT40X_SOFT_RESET_CMD)
+    {
+        u32Busy_us = SHT40X_SIM_RESET_US;
+        pDevice->resets++;
+    }
+    else if(pDevice->response_valid == 0)
+    {
+        pDevice->nacks++;
+        return 1;   /**< unknown command */
+    }
+
+    pDevice->busy_until_us = u64Now + u32Busy_us;
+    pDevice->commands++;
+
+    return 0;   /**< success */
+}
@@ -0,0 +1,193 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_sim.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 01:40 PM
+ */
+
+#ifndef SHT40X_DRIVER_SIM_H_INCLUDED
+#define SHT40X_DRIVER_SIM_H_INCLUDED
+
+#include "sht40x_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sht40x_sim_driver sht40x virtual device function
+ * @brief    software SHT4x model plugged behind the handle i2c_write / i2c_read pointers
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+/**
+ * @brief typical timing of the modelled device (us)
+ */
+#define SHT40X_SIM_CONVERSION_HIGH_US       6900UL              /**< high precision measurement */
+#define SHT40X_SIM_CONVERSION_MEDIUM_US     3700UL              /**< medium precision measurement */
+#define SHT40X_SIM_CONVERSION_LOWEST_US     1300UL              /**< lowest precision measurement */
+#define SHT40X_SIM_HEATER_1S_US             1000000UL           /**< long heater pulse, measurement included */
+#define SHT40X_SIM_HEATER_100mS_US          100000UL            /**< short heater pulse, measurement included */
+#define SHT40X_SIM_RESET_US                 1000UL              /**< soft reset */
+#define SHT40X_SIM_SERIAL_US                100UL               /**< serial number read */
+#define SHT40X_SIM_BUS_HZ                   400000UL            /**< default SCL frequency */
+
+/**
+* @brief sht40x virtual device structure definition
+* @note  the physical quantities are set by the test, the remaining fields are device state
+*/
+typedef struct sht40x_sim_device_s
+{
+    uint8_t address;                                                  /**< 7 bit i2c address */
+    uint8_t present;                                                  /**< 0 makes the device NACK everything */
+    uint32_t serial;                                                  /**< serial number returned by 0x89 */
+    int32_t temperature_mC;                                           /**< ambient temperature at time 0 */
+    int32_t humidity_mRH;                                             /**< ambient humidity at time 0 */
+    int32_t drift_mC_per_s;                                           /**< temperature drift */
+    int32_t drift_mRH_per_s;                                          /**< humidity drift */
+    int32_t noise_mC;                                                 /**< peak temperature noise at high precision */
+    int32_t noise_mRH;                                                /**< peak humidity noise at high precision */
+    int32_t heater_rise_mC;                                           /**< temperature rise reported after a 200 mW, 1 s pulse */
+    uint32_t conversion_us[3];                                        /**< measurement time per precision */
+    uint16_t crc_error_every;                                         /**< corrupt one response CRC out of N, 0 never */
+    uint32_t seed;                                                    /**< noise generator state */
+    uint64_t busy_until_us;                                           /**< end of the running command */
+    uint8_t response[RESPONSE_LENGTH];                                /**< response of the last command */
+    uint8_t response_valid;                                           /**< response ready to be read once */
+    uint32_t commands;                                                /**< commands accepted */
+    uint32_t reads;                                                   /**< responses delivered */
+    uint32_t nacks;                                                   /**< transfers NACKed */
+    uint32_t resets;                                                  /**< soft resets */
+} sht40x_sim_device_t;
+
+/**
+* @brief sht40x virtual bus structure definition
+*/
+typedef struct sht40x_sim_bus_s
+{
+    sht40x_sim_device_t *pDevices;                                    /**< devices on the bus */
+    uint8_t count;                                                    /**< number of devices */
+    uint32_t bus_hz;                                                  /**< SCL frequency used to time the transfers */
+    uint64_t (*now_us)(void *pContext);                               /**< external time source, NULL for the internal virtual clock */
+    void *pContext;                                                   /**< passed to now_us */
+    uint64_t virtual_us;                                              /**< internal clock, advanced by transfers and sht40x_sim_advance_us */
+    uint64_t bus_busy_us;                                             /**< time the bus spent transferring */
+    uint32_t transfers;                                               /**< transfers seen on the bus */
+} sht40x_sim_bus_t;
+
+/**
+ * @brief     This function initializes a virtual device with room conditions and datasheet timing
+ * @param[in] *pDevice points to the device structure
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u32Serial is the serial number
+ * @return  status code
+ *            - 0 success
+ *            - 2 pDevice is NULL
+ * @note      25 C, 50 %RH, no noise, no drift; adjust the fields afterwards
+ */
+uint8_t sht40x_sim_device_init(sht40x_sim_device_t *const pDevice, uint8_t u8Address, uint32_t u32Serial);
+
+/**
+ * @brief     This function initializes a virtual bus
+ * @param[in] *pBus points to the bus structure
+ * @param[in] *pDevices points to the devices on the bus
+ * @param[in] u8Count is the number of devices
+ * @return  status code
+ *            - 0 success
+ *            - 2 pBus is NULL
+ * @note      uses the internal virtual clock until now_us is set
+ */
+uint8_t sht40x_sim_bus_init(sht40x_sim_bus_t *const pBus, sht40x_sim_device_t *pDevices, uint8_t u8Count);
+
+/**
+ * @brief     This function advances the internal virtual clock
+ * @param[in] *pBus points to the bus structure
+ * @param[in] u32Us is the time to add in microseconds
+ * @return    none
+ * @note      call it from the delay function linked to the handle, ignored with an external clock
+ */
+void sht40x_sim_advance_us(sht40x_sim_bus_t *const pBus, uint32_t u32Us);
+
+/**
+ * @brief     This function returns the current time of a virtual bus
+ * @param[in] *pBus points to the bus structure
+ * @return    time in microseconds
+ * @note      none
+ */
+uint64_t sht40x_sim_now_us(sht40x_sim_bus_t *const pBus);
+
+/**
+ * @brief  virtual i2c bus init
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @return status code
+ *         - 0 success
+ *         - 1 pBus is NULL
+ * @note   none
+ */
+uint8_t sht40x_sim_i2c_init(void *pBus);
+
+/**
+ * @brief virtual i2c bus deinit
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @return status code
+ *          - 0 success
+ *          - 1 pBus is NULL
+ */
+uint8_t sht40x_sim_i2c_deinit(void *pBus);
+
+/**
+ * @brief      virtual i2c bus read
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[out] *pBuf points to a data buffer
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 address NACKed: no device, device busy or no response pending
+ * @note       a response is delivered once, like the real device
+ */
+uint8_t sht40x_sim_i2c_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @brief      virtual i2c bus write
+ * @param[in]  pBus points to a sht40x_sim_bus_t
+ * @param[in]  addr is the i2c device address 7 bit
+ * @param[in]  *pBuf points to the command byte
+ * @param[in]  u8Length is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 NACKed: no device, device busy or unknown command
+ * @note       none
+ */
+uint8_t sht40x_sim_i2c_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SHT40X_DRIVER_SIM_H_INCLUDED
@@ -0,0 +1,165 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_trace.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 04:30 PM
+ */
+
+#include "sht40x_driver_trace.h"
+
+/**
+* @brief This function serializes one entry for sht40x_dump_ring_write
+* @param[in] *pEntries points to the trace entries
+* @param[in] u16Slot is the storage index of the entry
+* @param[out] *pBuf points to SHT40X_TRACE_ENTRY_SIZE bytes
+* @return none
+* @note none
+*/
+static void a_sht40x_trace_serialize(const void *pEntries, uint16_t u16Slot, uint8_t *pBuf)
+{
+    const sht40x_trace_entry_t *pEntry = &((const sht40x_trace_entry_t *)pEntries)[u16Slot];
+
+    sht40x_dump_put32(&pBuf[0], pEntry->timestamp);
+    pBuf[4] = pEntry->address;
+    pBuf[5] = pEntry->op_status;
+    pBuf[6] = pEntry->command;
+    pBuf[7] = pEntry->length;
+    memcpy(&pBuf[8], pEntry->data, SHT40X_TRACE_DATA_MAX);
+    sht40x_dump_put16(&pBuf[14], pEntry->sequence);
+}
+
+/**
+ * @brief     This function initializes a trace ring
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] *pEntries points to the caller provided storage
+ * @param[in] u16Size is the number of entries, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pTrace or pEntries is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_TRACE, several handles may share a ring
+ */
+uint8_t sht40x_trace_init(sht40x_trace_t *const pTrace, sht40x_trace_entry_t *pEntries, uint16_t u16Size)
+{
+    if((pTrace == NULL) || (pEntries == NULL))
+        return 2;     /**< return failed error */
+    if(sht40x_dump_ring_init(&pTrace->ring, u16Size) != 0)
+        return 1;     /**< size must be a power of two */
+
+    memset(pEntries, 0, (size_t)u16Size * sizeof(sht40x_trace_entry_t));
+    pTrace->pEntries = pEntries;
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function records one transaction
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] u32Timestamp is the time of the transaction in ms
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u8OpStatus is SHT40X_TRACE_READ for a read, or'ed with the transport status
+ * @param[in] u8Command is the command written or answered
+ * @param[in] *pData points to the raw bytes, may be NULL
+ * @param[in] u8Length is the number of bytes, only SHT40X_TRACE_DATA_MAX are kept
+ * @return    none
+ * @note      called by the driver from a_sht40x_i2c_write / a_sht40x_i2c_read
+ */
+void sht40x_trace_record(sht40x_trace_t *const pTrace, uint32_t u32Timestamp, uint8_t u8Address, uint8_t u8OpStatus,
+                         uint8_t u8Command, const uint8_t *pData, uint8_t u8Length)
+{
+    uint16_t u16Sequence = (uint16_t)pTrace->ring.total;
+    sht40x_trace_entry_t *pEntry = &pTrace->pEntries[sht40x_dump_ring_next(&pTrace->ring)];
+    uint8_t u8Keep = (u8Length > SHT40X_TRACE_DATA_MAX) ? SHT40X_TRACE_DATA_MAX : u8Length;
+
+    pEntry->timestamp = u32Timestamp;
+    pEntry->address = u8Address;
+    pEntry->op_status = u8OpStatus;
+    pEntry->command = u8Command;
+    pEntry->length = u8Length;
+    pEntry->sequence = u16Sequence;
+    if((pData != NULL) && ((u8OpStatus & SHT40X_TRACE_STATUS_MASK) == 0))
+        memcpy(pEntry->data, pData, u8Keep);    /**< a failed read leaves nothing valid to keep */
+    else
+        u8Keep = 0;
+    memset(&pEntry->data[u8Keep], 0, SHT40X_TRACE_DATA_MAX - u8Keep);
+}
+
+/**
+ * @brief     This function returns the number of entries held
+ * @param[in] *pTrace points to the ring structure
+ * @return    entries held, at most the ring size
+ * @note      none
+ */
+uint16_t sht40x_trace_count(const sht40x_trace_t *const pTrace)
+{
+    return sht40x_dump_ring_count(&pTrace->ring);
+}
+
+/**
+ * @brief     This function reads an entry, oldest first
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] u16Index is 0 for the oldest entry held
+ * @param[out] *pEntry points to the entry to fill
+ * @return  status code
+ *            - 0 success
+ *            - 1 index out of range
+ *            - 2 pTrace or pEntry is NULL
+ * @note      none
+ */
+uint8_t sht40x_trace_get(const sht40x_trace_t *const pTrace, uint16_t u16Index, sht40x_trace_entry_t *pEntry)
+{
+    uint16_t u16Slot;
+
+    if((pTrace == NULL) || (pEntry == NULL))
+        return 2;     /**< return failed error */
+
+    if(sht40x_dump_ring_slot(&pTrace->ring, u16Index, &u16Slot) != 0)
+        return 1;     /**< nothing recorded there */
+
+    memcpy(pEntry, &pTrace->pEntries[u16Slot], sizeof(sht40x_trace_entry_t));
+
+    return 0;   /**< success */
+}
+
+/**
+ * @brief     This function serializes the ring for tools/sht40x_trace_decode
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] output is called with consecutive chunks of the dump
+ * @param[in] *pContext is passed to output
+ * @return  status code
+ *            - 0 success
+ *            - 2 pTrace or output is NULL
+ * @note      16 byte header (magic, entry size, entry count, lost entries) then the entries oldest
+ *            first, little endian, 16 bytes each. Stop recording while dumping.
+ */
+uint8_t sht40x_trace_dump(const sht40x_trace_t *const pTrace, void (*output)(void *pContext, const uint8_t *pBuf, uint8_t u8Length),
+                          void *pContext)
+{
+    if((pTrace == NULL) || (output == NULL))
+        return 2;     /**< return failed error */
+
+    sht40x_dump_ring_write(&pTrace->ring, SHT40X_TRACE_MAGIC, SHT40X_TRACE_ENTRY_SIZE, a_sht40x_trace_serialize, pTrace->pEntries,
+                           output, pContext);
+
+    return 0;   /**< success */
+}
@@ -0,0 +1,140 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_driver_trace.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 04:30 PM
+ */
+
+#ifndef SHT40X_DRIVER_TRACE_H_INCLUDED
+#define SHT40X_DRIVER_TRACE_H_INCLUDED
+
+#include "sht40x_driver.h"
+#include "sht40x_driver_dump.h"
+
+/**
+ * @defgroup sht40x_trace_driver sht40x bus trace function
+ * @brief    flight recorder of the i2c transactions of one or several handles
+ * @ingroup  sht40x driver
+ * @{
+ */
+
+#define SHT40X_TRACE_MAGIC              "SHT4XTR1"      /**< dump header magic, 8 bytes */
+#define SHT40X_TRACE_HEADER_SIZE        SHT40X_DUMP_HEADER_SIZE /**< dump header size */
+#define SHT40X_TRACE_ENTRY_SIZE         16U             /**< dump entry size */
+#define SHT40X_TRACE_DATA_MAX           6U              /**< raw bytes kept per transaction */
+#define SHT40X_TRACE_READ               0x80U           /**< op_status flag of a read, clear for a write */
+#define SHT40X_TRACE_STATUS_MASK        0x7FU           /**< op_status transport status bits */
+
+/**
+* @brief sht40x trace entry structure definition
+* @note  16 bytes, dumped field by field in little endian order
+*/
+typedef struct sht40x_trace_entry_s
+{
+    uint32_t timestamp;                                               /**< clock tick in ms, 0 without a clock */
+    uint8_t address;                                                  /**< 7 bit i2c address */
+    uint8_t op_status;                                                /**< SHT40X_TRACE_READ flag | transport status */
+    uint8_t command;                                                  /**< command written, or command answered by a read */
+    uint8_t length;                                                   /**< bytes requested */
+    uint8_t data[SHT40X_TRACE_DATA_MAX];                              /**< raw bytes on the bus */
+    uint16_t sequence;                                                /**< free running record number */
+} sht40x_trace_entry_t;
+
+/**
+* @brief sht40x trace ring structure definition
+* @note  the newest entries overwrite the oldest, the ring always holds the last transactions
+*/
+typedef struct sht40x_trace_s
+{
+    sht40x_trace_entry_t *pEntries;                                   /**< caller provided storage */
+    sht40x_dump_ring_t ring;                                          /**< indexes of pEntries */
+} sht40x_trace_t;
+
+/**
+ * @brief     This function initializes a trace ring
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] *pEntries points to the caller provided storage
+ * @param[in] u16Size is the number of entries, a power of two
+ * @return  status code
+ *            - 0 success
+ *            - 1 size is not a power of two
+ *            - 2 pTrace or pEntries is NULL
+ * @note      attach it with DRIVER_SHT40X_LINK_TRACE, several handles may share a ring
+ */
+uint8_t sht40x_trace_init(sht40x_trace_t *const pTrace, sht40x_trace_entry_t *pEntries, uint16_t u16Size);
+
+/**
+ * @brief     This function records one transaction
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] u32Timestamp is the time of the transaction in ms
+ * @param[in] u8Address is the 7 bit i2c address
+ * @param[in] u8OpStatus is SHT40X_TRACE_READ for a read, or'ed with the transport status
+ * @param[in] u8Command is the command written or answered
+ * @param[in] *pData points to the raw bytes, may be NULL
+ * @param[in] u8Length is the number of bytes, only SHT40X_TRACE_DATA_MAX are kept
+ * @return    none
+ * @note      called by the driver from a_sht40x_i2c_write / a_sht40x_i2c_read
+ */
+void sht40x_trace_record(sht40x_trace_t *const pTrace, uint32_t u32Timestamp, uint8_t u8Address, uint8_t u8OpStatus,
+                         uint8_t u8Command, const uint8_t *pData, uint8_t u8Length);
+
+/**
+ * @brief     This function returns the number of entries held
+ * @param[in] *pTrace points to the ring structure
+ * @return    entries held, at most the ring size
+ * @note      none
+ */
+uint16_t sht40x_trace_count(const sht40x_trace_t *const pTrace);
+
+/**
+ * @brief     This function reads an entry, oldest first
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] u16Index is 0 for the oldest entry held
+ * @param[out] *pEntry points to the entry to fill
+ * @return  status code
+ *            - 0 success
+ *            - 1 index out of range
+ *            - 2 pTrace or pEntry is NULL
+ * @note      none
+ */
+uint8_t sht40x_trace_get(const sht40x_trace_t *const pTrace, uint16_t u16Index, sht40x_trace_entry_t *pEntry);
+
+/**
+ * @brief     This function serializes the ring for tools/sht40x_trace_decode
+ * @param[in] *pTrace points to the ring structure
+ * @param[in] output is called with consecutive chunks of the dump
+ * @param[in] *pContext is passed to output
+ * @return  status code
+ *            - 0 success
+ *            - 2 pTrace or output is NULL
+ * @note      16 byte header (magic, entry size, entry count, lost entries) then the entries oldest
+ *            first, little endian, 16 bytes each. Stop recording while dumping.
+ */
+uint8_t sht40x_trace_dump(const sht40x_trace_t *const pTrace, void (*output)(void *pContext, const uint8_t *pBuf, uint8_t u8Length),
+                          void *pContext);
+
+/**
+ * @}
+ */
+
+#endif // SHT40X_DRIVER_TRACE_H_INCLUDED
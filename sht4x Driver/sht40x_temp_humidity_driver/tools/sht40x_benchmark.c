@@ -0,0 +1,636 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_benchmark.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 9:15 AM
+ */
+
+/**
+ * Host micro benchmark of the driver hot paths.
+ *
+ * Build with the sht40x_benchmark Code::Blocks project (Linux, gcc -O2), the project
+ * defines SHT40X_CRC_TABLE so both CRC-8 variants are available and SHT40X_LUT_FULL so
+ * both conversion tables are. The Release target uses the floating point conversion,
+ * Release_fixed defines SHT40X_FIXED_POINT.
+ *
+ * usage: sht40x_benchmark [--json] [--baseline FILE] [--tolerance PERCENT] [--noise-floor PERCENT]
+ *
+ *   --json         print the results as JSON, redirect it to a file to make a baseline
+ *   --baseline     compare against a JSON file written by --json, exit code 2 when a case
+ *                  got worse than the baseline by more than the tolerance
+ *   --tolerance    allowed slow down in percent, 10 by default
+ *   --noise-floor  smallest relative/op slow down that gates, BENCH_NOISE_FLOOR by default
+ *
+ * instructions/op is read from the perf_event interface when the kernel allows it
+ * (perf_event_paranoid), it is reported as null otherwise. The gate compares
+ * instructions/op when the baseline and the run both have it. Otherwise it compares
+ * relative/op: the fastest of BENCH_REPEAT runs of a case divided by the fastest run of a
+ * fixed calibration loop timed next to it, which takes the clock speed of the host out of
+ * the figure so a baseline carries over to another machine. Wall time still moves from run
+ * to run, by up to +66 % over the median on the shared VM tools/sht40x_benchmark_baseline.json
+ * comes from (median of 10 runs), so relative/op only gates beyond the noise floor: 75 %
+ * catches a case that doubled. Pass a lower --noise-floor on a quiet, dedicated host.
+ * ns/op is printed but never gates.
+ */
+
+#define _GNU_SOURCE
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#endif // __linux__
+#include "../sht40x_driver.h"
+#include "../sht40x_driver_clock.h"
+#include "../sht40x_driver_lut.h"
+#include "../sht40x_driver_mock.h"
+
+#define BENCH_ITERATIONS            10000000UL          /**< calls per measured case */
+#define BENCH_ITERATIONS_DRIVER     1000000UL           /**< calls per measured full driver path */
+#define BENCH_REPEAT                7U                  /**< runs per case, the fastest is kept */
+#define BENCH_CASES_MAX             16U                 /**< cases in a run or a baseline */
+#define BENCH_NAME_LENGTH           32U                 /**< case name storage */
+#define BENCH_NOISE_FLOOR           75.0                /**< relative/op slow down in percent below which nothing gates */
+
+#ifdef SHT40X_FIXED_POINT
+#define BENCH_BUILD                 "fixed"             /**< conversion the driver is built with */
+#else
+#define BENCH_BUILD                 "float"             /**< conversion the driver is built with */
+#endif // SHT40X_FIXED_POINT
+
+/**
+ * @brief benchmark case result
+ */
+typedef struct bench_result_s
+{
+    char name[BENCH_NAME_LENGTH];                       /**< case name */
+    unsigned long iterations;                           /**< calls measured */
+    double ns_per_op;                                   /**< wall time per call */
+    double relative_per_op;                             /**< wall time per call in calibration loops */
+    double instructions_per_op;                         /**< retired user instructions per call, < 0 when unknown */
+} bench_result_t;
+
+static volatile uint32_t sink;                          /**< keeps the optimizer from dropping the work */
+static int perf_fd = -1;                                /**< instruction counter, -1 when unavailable */
+static bench_result_t results[BENCH_CASES_MAX];
+static uint8_t result_count;
+
+static sht40x_vclock_t bench_clock;                     /**< delays of the full path cost nothing */
+static sht40x_mock_t bench_mock;
+static sht40x_handle_t bench_handle;
+
+/**
+ * @brief  read the monotonic clock
+ * @return time in nanoseconds
+ */
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  open the retired instruction counter of this thread
+ * @note   leaves perf_fd at -1 when the counter is not available
+ */
+static void bench_perf_open(void)
+{
+#if defined(__linux__) && defined(SYS_perf_event_open)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+/**
+ * @brief  start the instruction counter
+ */
+static void bench_perf_start(void)
+{
+#ifdef __linux__
+    if(perf_fd >= 0)
+    {
+        ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/**
+ * @brief  stop the instruction counter
+ * @return instructions retired since bench_perf_start, -1 when unavailable
+ */
+static double bench_perf_stop(void)
+{
+#ifdef __linux__
+    uint64_t u64Count;
+
+    if(perf_fd >= 0)
+    {
+        ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if(read(perf_fd, &u64Count, sizeof(u64Count)) == (ssize_t)sizeof(u64Count))
+        {
+            return (double)u64Count;
+        }
+    }
+#endif
+    return -1.0;
+}
+
+/**
+ * @brief     run the calibration loop, a dependent multiply-add chain the optimizer cannot shorten
+ */
+static uint32_t bench_calibrate(unsigned long iterations)
+{
+    uint32_t u32Acc = 1;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc = (u32Acc * 1664525UL) + 1013904223UL + (uint32_t)index;
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     time one loop
+ * @param[in] run is the loop to measure
+ * @param[in] iterations is the number of calls the loop performs
+ * @return    wall time per call in nanoseconds
+ */
+static double bench_time(uint32_t (*run)(unsigned long), unsigned long iterations)
+{
+    uint64_t u64Start;
+
+    u64Start = bench_now_ns();
+    sink = run(iterations);
+    return (double)(bench_now_ns() - u64Start) / (double)iterations;
+}
+
+/**
+ * @brief     measure one case
+ * @param[in] name is the case name
+ * @param[in] run is the loop to measure, returns a value folded into sink
+ * @param[in] iterations is the number of calls the loop performs
+ */
+static void bench_run(const char *name, uint32_t (*run)(unsigned long), unsigned long iterations)
+{
+    bench_result_t *pResult;
+    double instructions;
+    double calibration = -1.0;
+    double ns;
+    uint8_t repeat;
+
+    if(result_count >= BENCH_CASES_MAX)
+    {
+        return;
+    }
+
+    pResult = &results[result_count++];
+    strncpy(pResult->name, name, BENCH_NAME_LENGTH - 1);
+    pResult->name[BENCH_NAME_LENGTH - 1] = '\0';
+    pResult->iterations = iterations;
+    pResult->ns_per_op = -1.0;
+
+    sink = run(iterations / 100UL);     /**< warm up caches and branch predictors */
+
+    for(repeat = 0; repeat < BENCH_REPEAT; repeat++)
+    {
+        ns = bench_time(bench_calibrate, iterations);
+        if((calibration < 0) || (ns < calibration))
+            calibration = ns;
+
+        bench_perf_start();
+        ns = bench_time(run, iterations);
+        instructions = bench_perf_stop();
+
+        if((pResult->ns_per_op < 0) || (ns < pResult->ns_per_op))
+        {
+            pResult->ns_per_op = ns;        /**< the fastest run has the least interference */
+            pResult->instructions_per_op = (instructions < 0) ? -1.0 : instructions / (double)iterations;
+        }
+    }
+    pResult->relative_per_op = pResult->ns_per_op / calibration;
+}
+
+/**
+ * @brief     run the bitwise CRC-8 over changing 2-byte words
+ */
+static uint32_t bench_crc8_bitwise(unsigned long iterations)
+{
+    uint8_t pWord[2];
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        pWord[0] = (uint8_t)(index >> 8);
+        pWord[1] = (uint8_t)index;
+        u32Acc += sht40x_crc8_bitwise(pWord, 2);
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the table CRC-8 over changing 2-byte words
+ */
+static uint32_t bench_crc8_table(unsigned long iterations)
+{
+    uint8_t pWord[2];
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        pWord[0] = (uint8_t)(index >> 8);
+        pWord[1] = (uint8_t)index;
+        u32Acc += sht40x_crc8_table(pWord, 2);
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the integer conversions of one sample (mC, mF, mRH)
+ */
+static uint32_t bench_convert_fixed(unsigned long iterations)
+{
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += (uint32_t)sht40x_convert_temperature_mC((uint16_t)(index * 7U));
+        u32Acc += (uint32_t)sht40x_convert_temperature_mF((uint16_t)(index * 7U));
+        u32Acc += (uint32_t)sht40x_convert_humidity_mRH((uint16_t)(index * 13U));
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the integer conversions of one sample (mC, mRH), reference of the table cases
+ */
+static uint32_t bench_convert_arith(unsigned long iterations)
+{
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += (uint32_t)sht40x_convert_temperature_mC((uint16_t)(index * 7U));
+        u32Acc += (uint32_t)sht40x_convert_humidity_mRH((uint16_t)(index * 13U));
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the coarse table conversions of one sample (mC, mRH)
+ */
+static uint32_t bench_lut_coarse(unsigned long iterations)
+{
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += (uint32_t)sht40x_lut_temperature_mC((uint16_t)(index * 7U));
+        u32Acc += (uint32_t)sht40x_lut_humidity_mRH((uint16_t)(index * 13U));
+    }
+    return u32Acc;
+}
+
+#ifdef SHT40X_LUT_FULL
+/**
+ * @brief     run the full table conversions of one sample (mC, mRH)
+ */
+static uint32_t bench_lut_full(unsigned long iterations)
+{
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += (uint32_t)sht40x_lut_full_temperature_mC((uint16_t)(index * 7U));
+        u32Acc += (uint32_t)sht40x_lut_full_humidity_mRH((uint16_t)(index * 13U));
+    }
+    return u32Acc;
+}
+#endif // SHT40X_LUT_FULL
+
+/**
+ * @brief     run the conversion the driver is built with on one sample, CRC rebuild included
+ */
+static uint32_t bench_convert_ticks(unsigned long iterations)
+{
+    sht40x_data_t data;
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    for(index = 0; index < iterations; index++)
+    {
+        sht40x_convert_ticks((uint16_t)(index * 7U), (uint16_t)(index * 13U), &data);
+        u32Acc += (uint32_t)sht40x_humidity_mRH(&data);
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the full serial number read against the scripted transport
+ */
+static uint32_t bench_serial_number(unsigned long iterations)
+{
+    static const uint8_t pFrame[RESPONSE_LENGTH] = {0x12, 0x34, 0x37, 0x56, 0x78, 0x7D};
+    uint32_t u32Serial;
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    sht40x_mock_init(&bench_mock, 1);
+    sht40x_mock_expect_write(&bench_mock, bench_handle.i2c_address, SHT40X_READ_SERIAL_NUMBER_CMD, 0);
+    sht40x_mock_expect_read(&bench_mock, bench_handle.i2c_address, pFrame, RESPONSE_LENGTH, 0);
+
+    for(index = 0; index < iterations; index++)
+    {
+        bench_handle.serial_valid = 0;          /**< measure the bus read and decode, not the cache */
+        u32Acc += sht40x_get_serial_number(&bench_handle, &u32Serial);
+        u32Acc += u32Serial;
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the full blocking measurement against the scripted transport
+ */
+static uint32_t bench_get_temp_rh(unsigned long iterations)
+{
+    sht40x_data_t data;
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    sht40x_mock_init(&bench_mock, 1);
+    sht40x_mock_expect_measurement(&bench_mock, bench_handle.i2c_address, SHT40X_MEASURE_T_RH_HIGH_PREC_CMD, 0x6666, 0x8000);
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += sht40x_get_temp_rh(&bench_handle, SHT40X_PRECISION_HIGH, &data);
+        u32Acc += (uint32_t)sht40x_temperature_mC(&data);
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     run the full measurement read against the scripted transport, raw ticks only
+ */
+static uint32_t bench_read_ticks(unsigned long iterations)
+{
+    sht40x_ticks_t ticks;
+    uint32_t u32Acc = 0;
+    unsigned long index;
+
+    sht40x_mock_init(&bench_mock, 1);
+    sht40x_mock_expect_measurement(&bench_mock, bench_handle.i2c_address, SHT40X_MEASURE_T_RH_HIGH_PREC_CMD, 0x6666, 0x8000);
+
+    for(index = 0; index < iterations; index++)
+    {
+        u32Acc += sht40x_read_ticks(&bench_handle, SHT40X_PRECISION_HIGH, &ticks);
+        u32Acc += ticks.temperature;
+    }
+    return u32Acc;
+}
+
+/**
+ * @brief     discard the driver debug messages
+ */
+static void bench_debug_print(char *fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     link the driver to the scripted transport and the virtual clock
+ * @return    0 on success
+ */
+static uint8_t bench_driver_init(void)
+{
+    DRIVER_SHT40X_LINK_INIT(&bench_handle, sht40x_handle_t);
+    DRIVER_SHT40X_LINK_I2C_INIT(&bench_handle, sht40x_mock_i2c_init);
+    DRIVER_SHT40X_LINK_I2C_DEINIT(&bench_handle, sht40x_mock_i2c_deinit);
+    DRIVER_SHT40X_LINK_I2C_WRITE(&bench_handle, sht40x_mock_i2c_write);
+    DRIVER_SHT40X_LINK_I2C_READ(&bench_handle, sht40x_mock_i2c_read);
+    DRIVER_SHT40X_LINK_I2C_BUS(&bench_handle, &bench_mock);
+    DRIVER_SHT40X_LINK_DEBUG_PRINT(&bench_handle, bench_debug_print);
+    DRIVER_SHT40X_LINK_CLOCK(&bench_handle, &bench_clock, sht40x_vclock_now_ms, sht40x_vclock_delay_ms);
+
+    sht40x_vclock_init(&bench_clock, 0);
+    sht40x_mock_init(&bench_mock, 1);
+    if(sht40x_init(&bench_handle) != 0)
+        return 1;
+    if(sht40x_set_variant(&bench_handle, SHT40_AD1B_VARIANT) != 0)
+        return 1;
+    return sht40x_set_addr(&bench_handle);
+}
+
+/**
+ * @brief     print the results as text or JSON
+ * @param[in] json is 1 for JSON
+ */
+static void bench_print(int json)
+{
+    uint8_t index;
+
+    if(json)
+    {
+        printf("{\n  \"build\": \"%s\",\n  \"cases\": [\n", BENCH_BUILD);
+        for(index = 0; index < result_count; index++)
+        {
+            printf("    {\"name\": \"%s\", \"iterations\": %lu, \"ns_per_op\": %.3f, \"relative_per_op\": %.3f, ",
+                   results[index].name, results[index].iterations, results[index].ns_per_op, results[index].relative_per_op);
+            if(results[index].instructions_per_op < 0)
+                printf("\"instructions_per_op\": null}");
+            else
+                printf("\"instructions_per_op\": %.1f}", results[index].instructions_per_op);
+            printf("%s\n", (index + 1U < result_count) ? "," : "");
+        }
+        printf("  ]\n}\n");
+        return;
+    }
+
+    for(index = 0; index < result_count; index++)
+    {
+        printf("%-24s %10.2f ns/op %8.2f relative/op", results[index].name, results[index].ns_per_op,
+               results[index].relative_per_op);
+        if(results[index].instructions_per_op >= 0)
+            printf(" %10.1f instructions/op", results[index].instructions_per_op);
+        printf("\n");
+    }
+}
+
+/**
+ * @brief     compare the results with a baseline written by --json
+ * @param[in] path is the baseline file
+ * @param[in] tolerance is the allowed slow down in percent
+ * @param[in] noise_floor is the smallest relative/op slow down in percent that gates
+ * @return    0 no regression, 1 baseline unreadable, 2 regression found
+ * @note      instructions/op gates when both sides have it, relative/op otherwise
+ */
+static int bench_compare(const char *path, double tolerance, double noise_floor)
+{
+    FILE *pFile;
+    char line[256];
+    char name[BENCH_NAME_LENGTH];
+    const char *pField;
+    unsigned long iterations;
+    double baseline;
+    double relative;
+    double instructions;
+    double change;
+    uint8_t index;
+    int regressed;
+    int status = 0;
+
+    pFile = fopen(path, "r");
+    if(pFile == NULL)
+    {
+        fprintf(stderr, "cannot open baseline %s\n", path);
+        return 1;
+    }
+
+    while(fgets(line, sizeof(line), pFile) != NULL)
+    {
+        if(sscanf(line, " \"build\": \"%31[^\"]\"", name) == 1)
+        {
+            if(strcmp(name, BENCH_BUILD) != 0)
+                fprintf(stderr, "warning: baseline is a %s build, this is a %s build\n", name, BENCH_BUILD);
+            continue;
+        }
+        if(sscanf(line, " {\"name\": \"%31[^\"]\", \"iterations\": %lu, \"ns_per_op\": %lf", name, &iterations, &baseline) != 3)
+            continue;
+        relative = -1.0;
+        pField = strstr(line, "\"relative_per_op\":");
+        if((pField == NULL) || (sscanf(pField, "\"relative_per_op\": %lf", &relative) != 1))
+            relative = -1.0;            /**< baseline made before the calibration loop */
+        instructions = -1.0;
+        pField = strstr(line, "\"instructions_per_op\":");
+        if((pField == NULL) || (sscanf(pField, "\"instructions_per_op\": %lf", &instructions) != 1))
+            instructions = -1.0;        /**< null, no counter when the baseline was made */
+
+        for(index = 0; index < result_count; index++)
+        {
+            if(strcmp(results[index].name, name) != 0)
+                continue;
+            if((instructions > 0) && (results[index].instructions_per_op >= 0))
+            {
+                change = ((results[index].instructions_per_op / instructions) - 1.0) * 100.0;
+                regressed = (change > tolerance);
+                fprintf(stderr, "%-24s %10.1f -> %10.1f instructions/op %+7.1f %%%s\n", name, instructions,
+                        results[index].instructions_per_op, change, regressed ? "  REGRESSION" : "");
+            }
+            else if(relative > 0)
+            {
+                change = ((results[index].relative_per_op / relative) - 1.0) * 100.0;
+                regressed = (change > tolerance) && (change > noise_floor);
+                fprintf(stderr, "%-24s %10.2f -> %10.2f relative/op %+7.1f %%%s\n", name, relative,
+                        results[index].relative_per_op, change, regressed ? "  REGRESSION" : "");
+            }
+            else
+            {
+                fprintf(stderr, "%-24s no instructions/op or relative/op in the baseline, not compared\n", name);
+                regressed = 0;
+            }
+            if(regressed)
+                status = 2;
+        }
+    }
+    fclose(pFile);
+
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t pCheck[2] = {0xBE, 0xEF};
+    const char *baseline = NULL;
+    double tolerance = 10.0;
+    double noise_floor = BENCH_NOISE_FLOOR;
+    int json = 0;
+    int index;
+
+    for(index = 1; index < argc; index++)
+    {
+        if(strcmp(argv[index], "--json") == 0)
+            json = 1;
+        else if((strcmp(argv[index], "--baseline") == 0) && (index + 1 < argc))
+            baseline = argv[++index];
+        else if((strcmp(argv[index], "--tolerance") == 0) && (index + 1 < argc))
+            tolerance = atof(argv[++index]);
+        else if((strcmp(argv[index], "--noise-floor") == 0) && (index + 1 < argc))
+            noise_floor = atof(argv[++index]);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--baseline FILE] [--tolerance PERCENT] [--noise-floor PERCENT]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if((sht40x_crc8_bitwise(pCheck, 2) != 0x92) || (sht40x_crc8_table(pCheck, 2) != 0x92))
+    {
+        printf("crc8 self check failed\n");        /**< datasheet example: 0xBEEF -> 0x92 */
+        return 1;
+    }
+    if(bench_driver_init() != 0)
+    {
+        printf("driver init failed\n");
+        return 1;
+    }
+
+    bench_perf_open();
+
+    bench_run("crc8_bitwise", bench_crc8_bitwise, BENCH_ITERATIONS);
+    bench_run("crc8_table", bench_crc8_table, BENCH_ITERATIONS);
+    bench_run("convert_fixed", bench_convert_fixed, BENCH_ITERATIONS);
+    bench_run("convert_ticks", bench_convert_ticks, BENCH_ITERATIONS);
+    bench_run("convert_arith", bench_convert_arith, BENCH_ITERATIONS);
+    bench_run("lut_coarse", bench_lut_coarse, BENCH_ITERATIONS);
+#ifdef SHT40X_LUT_FULL
+    bench_run("lut_full", bench_lut_full, BENCH_ITERATIONS);
+#endif // SHT40X_LUT_FULL
+    bench_run("serial_number", bench_serial_number, BENCH_ITERATIONS_DRIVER);
+    bench_run("get_temp_rh", bench_get_temp_rh, BENCH_ITERATIONS_DRIVER);
+    bench_run("read_ticks", bench_read_ticks, BENCH_ITERATIONS_DRIVER);
+
+    bench_print(json);
+
+    if(baseline != NULL)
+    {
+        return bench_compare(baseline, tolerance, noise_floor);
+    }
+    return 0;
+}
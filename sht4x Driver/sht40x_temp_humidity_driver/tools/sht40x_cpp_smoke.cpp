@@ -0,0 +1,178 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_cpp_smoke.cpp
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+/**
+ * Host smoke test of the C++17 binding (sht40x_driver.hpp) against the virtual device.
+ *
+ * Build with the sht40x_cpp_smoke Code::Blocks project (Linux, g++ -std=c++17). The
+ * Transport and Clock policies forward to the sim bus, the results are compared with the
+ * virtual device and with the C driver.
+ *
+ * usage: sht40x_cpp_smoke
+ *
+ * Prints every failed check, exit code 1 when a check failed.
+ */
+
+#include "../sht40x_driver.hpp"
+#include "../sht40x_driver_sim.h"
+
+#define SMOKE_CHECK(condition)      smoke_check((condition) ? 1 : 0, #condition, __LINE__)
+
+static unsigned long checks;                            /**< checks run */
+static unsigned long failures;                          /**< checks failed */
+
+static sht40x_sim_device_t smoke_device;
+static sht40x_sim_bus_t smoke_bus;
+static uint32_t smoke_waited_ms;                        /**< time waited through the Clock policy */
+
+/**
+ * @brief     count a check and print it when it failed
+ * @param[in] ok is 1 when the check passed
+ * @param[in] pText is the checked expression
+ * @param[in] line is the source line of the check
+ */
+static void smoke_check(int ok, const char *pText, int line)
+{
+    checks++;
+    if(!ok)
+    {
+        failures++;
+        printf("    FAIL line %d: %s\n", line, pText);
+    }
+}
+
+/**
+ * @brief Transport policy on the sim bus
+ */
+struct SimTransport
+{
+    static uint8_t write(uint8_t addr, const uint8_t *pBuf, uint8_t u8Length)
+    {
+        uint8_t pCopy[1] = { pBuf[0] };
+
+        return sht40x_sim_i2c_write(&smoke_bus, addr, pCopy, u8Length);
+    }
+
+    static uint8_t read(uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+    {
+        return sht40x_sim_i2c_read(&smoke_bus, addr, pBuf, u8Length);
+    }
+};
+
+/**
+ * @brief Clock policy advancing the sim bus
+ */
+struct SimClock
+{
+    static void delay_ms(uint32_t u32Ms)
+    {
+        smoke_waited_ms += u32Ms;
+        sht40x_sim_advance_us(&smoke_bus, u32Ms * 1000UL);
+    }
+};
+
+using Sensor = sht4x::Sensor<SimTransport, SimClock, SHT40_AD1B_VARIANT>;
+
+static_assert(Sensor::kAddress == SHT40_AD1B_IIC_ADDRESS, "variant address");
+static_assert(sht4x::command(sht4x::Precision::Medium) == SHT40X_MEASURE_T_RH_MIDIUM_PREC_CMD, "measurement command");
+static_assert(sht4x::command(sht4x::Heater::P20mW_1s) == SHT40X_ACTIVATE_HEATER_20mW_1_S_CMD, "heater command");
+static_assert(sht4x::delay_ms(sht4x::Precision::Lowest) == MEASUREMENT_DELAY_LOWEST_PREC, "conversion time");
+
+/**
+ * @brief     tell whether a measurement matches the device and the C conversion
+ * @param[in] m is the measurement
+ * @param[in] i32Rise_mC is the expected temperature rise above ambient
+ * @return    1 when both quantities are within 0.1 C and 0.1 %RH and equal to the C driver
+ */
+static int smoke_near(const sht4x::Measurement &m, int32_t i32Rise_mC)
+{
+    int32_t i32Temperature = m.temperature_mC() - (smoke_device.temperature_mC + i32Rise_mC);
+    int32_t i32Humidity = m.humidity_mRH() - smoke_device.humidity_mRH;
+
+    return (i32Temperature > -100) && (i32Temperature < 100) && (i32Humidity > -100) && (i32Humidity < 100) &&
+           (m.temperature_mC() == sht40x_convert_temperature_mC(m.temperature)) &&
+           (m.temperature_mF() == sht40x_convert_temperature_mF(m.temperature)) &&
+           (m.humidity_mRH() == sht40x_convert_humidity_mRH(m.humidity));
+}
+
+int main(void)
+{
+    sht4x::Measurement m{};
+    uint32_t u32Serial = 0;
+    uint32_t u32Same = 0;
+    uint32_t u32Ticks;
+
+    (void)sht40x_sim_device_init(&smoke_device, SHT40_AD1B_IIC_ADDRESS, 0x12345678UL);
+    smoke_device.temperature_mC = 21000L;
+    smoke_device.humidity_mRH = 45000L;
+    (void)sht40x_sim_bus_init(&smoke_bus, &smoke_device, 1);
+
+    SMOKE_CHECK(Sensor::measure(m) == sht4x::Status::Ok);
+    SMOKE_CHECK(smoke_near(m, 0));
+    SMOKE_CHECK(smoke_waited_ms == MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH]);
+    SMOKE_CHECK(Sensor::measure<sht4x::Precision::Lowest>(m) == sht4x::Status::Ok);
+    SMOKE_CHECK(smoke_near(m, 0));
+
+    smoke_waited_ms = 0;
+    SMOKE_CHECK(Sensor::heat<sht4x::Heater::P110mW_100ms>(m) == sht4x::Status::Ok);
+    SMOKE_CHECK(smoke_waited_ms == HEATER_DELAY[SHT40X_HEATER_POWER_110mW_100mS]);
+    SMOKE_CHECK(m.temperature_mC() > smoke_device.temperature_mC);
+    smoke_waited_ms = 0;
+    SMOKE_CHECK(Sensor::heat<sht4x::Heater::P20mW_1s>(m) == sht4x::Status::Ok);
+    SMOKE_CHECK(smoke_waited_ms == HEATER_DELAY[SHT40X_HEATER_POWER_20mW_1S]);
+
+    smoke_waited_ms = 0;
+    SMOKE_CHECK(Sensor::serial_number(u32Serial) == sht4x::Status::Ok);
+    SMOKE_CHECK((u32Serial == smoke_device.serial) && (smoke_waited_ms == SERIAL_NUMBER_DELAY));
+    SMOKE_CHECK(Sensor::soft_reset() == sht4x::Status::Ok);
+    SMOKE_CHECK(smoke_device.resets == 1);
+
+    SMOKE_CHECK(Sensor::start<sht4x::Precision::High>() == sht4x::Status::Ok);
+    SMOKE_CHECK(Sensor::fetch(m) == sht4x::Status::Failed);       /**< NACKed while converting */
+    SimClock::delay_ms(MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH]);
+    SMOKE_CHECK(Sensor::fetch(m) == sht4x::Status::Ok);
+
+    smoke_device.crc_error_every = 1;
+    SMOKE_CHECK(Sensor::measure(m) == sht4x::Status::Crc);
+    smoke_device.crc_error_every = 0;
+    smoke_device.present = 0;
+    SMOKE_CHECK(Sensor::measure(m) == sht4x::Status::Failed);
+
+    for(u32Ticks = 0; u32Ticks <= 0xFFFFUL; u32Ticks++)
+    {
+        m.temperature = static_cast<uint16_t>(u32Ticks);
+        m.humidity = static_cast<uint16_t>(u32Ticks);
+        if((m.temperature_mC() == sht40x_convert_temperature_mC(m.temperature)) &&
+           (m.temperature_mF() == sht40x_convert_temperature_mF(m.temperature)) &&
+           (m.humidity_mRH() == sht40x_convert_humidity_mRH(m.humidity)))
+            u32Same++;
+    }
+    SMOKE_CHECK(u32Same == 0x10000UL);      /**< same result as the C driver on every tick */
+
+    printf("%lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_decode.h
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 11:20 PM
+ */
+
+/**
+ * Dump reader shared by the host decoders, sht40x_trace_decode and sht40x_log_decode.
+ *
+ * Both dumps are written by sht40x_dump_ring_write (sht40x_driver_dump.h): a 16 byte header
+ * (magic, entry size, entry count, lost entries) then the entries, little endian.
+ */
+
+#ifndef SHT40X_DECODE_H_INCLUDED
+#define SHT40X_DECODE_H_INCLUDED
+
+#include <ctype.h>
+#include "../sht40x_driver_dump.h"
+
+#define DECODE_DUMP_MAX             (SHT40X_DUMP_HEADER_SIZE + (65536UL * SHT40X_DUMP_ENTRY_MAX))   /**< largest dump */
+
+/**
+ * @brief     read a little endian 16 bit value
+ */
+static uint16_t decode_get16(const uint8_t *pBuf)
+{
+    return (uint16_t)(pBuf[0] | (pBuf[1] << 8));
+}
+
+/**
+ * @brief     read a little endian 32 bit value
+ */
+static uint32_t decode_get32(const uint8_t *pBuf)
+{
+    return (uint32_t)decode_get16(pBuf) | ((uint32_t)decode_get16(&pBuf[2]) << 16);
+}
+
+/**
+ * @brief     load the whole input, binary or hex text
+ * @param[in] *pMagic is the magic of a raw binary dump
+ * @return    number of bytes loaded
+ */
+static size_t decode_load(FILE *pFile, uint8_t *pDump, const char *pMagic)
+{
+    size_t length = fread(pDump, 1, DECODE_DUMP_MAX, pFile);
+    size_t index;
+    size_t out = 0;
+    int high = -1;
+
+    if((length >= SHT40X_DUMP_MAGIC_SIZE) && (memcmp(pDump, pMagic, SHT40X_DUMP_MAGIC_SIZE) == 0))
+    {
+        return length;      /**< raw binary dump */
+    }
+
+    for(index = 0; index < length; index++)     /**< hex text, packed in place */
+    {
+        int c = pDump[index];
+        int nibble;
+
+        if(!isxdigit(c))
+        {
+            high = -1;      /**< separators and 0x prefixes end a byte */
+            continue;
+        }
+        nibble = isdigit(c) ? (c - '0') : (tolower(c) - 'a' + 10);
+        if(high < 0)
+        {
+            high = nibble;
+        }
+        else
+        {
+            pDump[out++] = (uint8_t)((high << 4) | nibble);
+            high = -1;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief     load the dump named on the command line and check its header
+ * @param[in] *pMagic is the magic of the expected dump
+ * @param[in] u16EntrySize is the smallest entry size this decoder reads
+ * @param[in] *pName names the dump in the error messages
+ * @param[out] *pDump points to DECODE_DUMP_MAX bytes receiving the dump
+ * @param[out] *pEntrySize points to the entry size announced
+ * @param[out] *pCount points to the number of entries announced
+ * @return    0 on success, 1 after printing the error
+ */
+static int decode_read(int argc, char *argv[], const char *pMagic, uint16_t u16EntrySize, const char *pName,
+                       uint8_t *pDump, uint16_t *pEntrySize, uint16_t *pCount)
+{
+    FILE *pFile = stdin;
+    size_t length;
+
+    if(argc > 2)
+    {
+        fprintf(stderr, "usage: %s [FILE]\n", argv[0]);
+        return 1;
+    }
+    if(argc == 2)
+    {
+        pFile = fopen(argv[1], "rb");
+        if(pFile == NULL)
+        {
+            fprintf(stderr, "cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    length = decode_load(pFile, pDump, pMagic);
+    if(pFile != stdin)
+        fclose(pFile);
+
+    if((length < SHT40X_DUMP_HEADER_SIZE) || (memcmp(pDump, pMagic, SHT40X_DUMP_MAGIC_SIZE) != 0))
+    {
+        fprintf(stderr, "not a sht40x %s dump\n", pName);
+        return 1;
+    }
+    *pEntrySize = decode_get16(&pDump[8]);
+    *pCount = decode_get16(&pDump[10]);
+    if((*pEntrySize < u16EntrySize) || (length < SHT40X_DUMP_HEADER_SIZE + ((size_t)*pCount * *pEntrySize)))
+    {
+        fprintf(stderr, "truncated dump: %lu entries announced\n", (unsigned long)*pCount);
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif // SHT40X_DECODE_H_INCLUDED
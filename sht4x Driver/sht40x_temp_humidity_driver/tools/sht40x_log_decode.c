@@ -0,0 +1,153 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_log_decode.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 10:05 PM
+ */
+
+/**
+ * Host decoder of the dumps written by sht40x_log_dump (sht40x_driver_log.h).
+ *
+ * usage: sht40x_log_decode [FILE]
+ *
+ * FILE is the raw binary dump, or the same bytes as hex text (e.g. captured from a
+ * serial console), standard input when omitted. The message texts live here only, the
+ * target records an event number and one argument. Prints one line per event then a
+ * per address count of errors.
+ */
+
+#include "../sht40x_driver.h"
+#include "../sht40x_driver_log.h"
+#include "sht40x_decode.h"
+
+/**
+ * @brief event text, %u / %X receive the argument
+ */
+typedef struct decode_event_s
+{
+    uint8_t event;                                      /**< sht40x_log_event_t */
+    const char *pFormat;                                /**< message */
+} decode_event_t;
+
+static const decode_event_t events[] =
+{
+    { SHT40X_LOG_CRC_ERROR,             "CRC mismatch, received CRC bytes 0x%04X" },
+    { SHT40X_LOG_LINK_MISSING,          "link missing (0 delay, 1 i2c_init, 2 i2c_deinit, 3 i2c_read, 4 i2c_write): %u" },
+    { SHT40X_LOG_I2C_INIT_FAILED,       "failed to initialize i2c" },
+    { SHT40X_LOG_I2C_DEINIT_FAILED,     "failed to de-initialize i2c" },
+    { SHT40X_LOG_SET_ADDRESS_FAILED,    "failed to set i2c address 0x%02X" },
+    { SHT40X_LOG_GET_ADDRESS_FAILED,    "failed to get i2c address" },
+    { SHT40X_LOG_SET_VARIANT_FAILED,    "failed to set device variant %u" },
+    { SHT40X_LOG_GET_VARIANT_FAILED,    "failed to get device variant" },
+    { SHT40X_LOG_NO_MEASUREMENT,        "fetch without measurement started, pending command 0x%02X" },
+    { SHT40X_LOG_MEASURE_READ_FAILED,   "failed to read temp and humidity, precision %u" },
+    { SHT40X_LOG_MEASURE_CMD_FAILED,    "failed to write temp and humidity cmd, precision %u" },
+    { SHT40X_LOG_INVALID_PRECISION,     "invalid precision %u" },
+    { SHT40X_LOG_SERIAL_READ_FAILED,    "failed to get UID" },
+    { SHT40X_LOG_SERIAL_CMD_FAILED,     "failed to write UID cmd" },
+    { SHT40X_LOG_HEATER_CMD_FAILED,     "failed to write heater cmd, power %u" },
+    { SHT40X_LOG_NO_HEATER,             "fetch heater without heater started, pending command 0x%02X" },
+    { SHT40X_LOG_HEATER_READ_FAILED,    "failed to read heater measurement, power %u" },
+    { SHT40X_LOG_RESET_FAILED,          "failed to reset" },
+    { SHT40X_LOG_INVALID_HEATER_POWER,  "invalid heater power %u" },
+    { SHT40X_LOG_INIT,                  "initialized" },
+    { SHT40X_LOG_RESET,                 "soft reset" },
+    { SHT40X_LOG_BUSY_NACK,             "busy, NACK %u ms after the command" },
+};
+
+static unsigned long errors[128];                       /**< error events per address */
+static unsigned long infos[128];                        /**< information events per address */
+
+/**
+ * @brief     find the text of an event
+ * @return    format, NULL for an event this decoder does not know
+ */
+static const char *decode_format(uint8_t u8Event)
+{
+    size_t index;
+
+    for(index = 0; index < sizeof(events) / sizeof(events[0]); index++)
+    {
+        if(events[index].event == u8Event)
+            return events[index].pFormat;
+    }
+    return NULL;
+}
+
+/**
+ * @brief     print one event
+ */
+static void decode_event(const uint8_t *pEntry, uint32_t u32Previous, int first)
+{
+    uint32_t u32Time = decode_get32(&pEntry[0]);
+    uint8_t u8Event = pEntry[4];
+    uint8_t u8Address = pEntry[5] & 0x7F;
+    uint16_t u16Argument = decode_get16(&pEntry[6]);
+    const char *pFormat = decode_format(u8Event);
+
+    printf("%10lu %+7ld  0x%02X  ", (unsigned long)u32Time, first ? 0L : (long)(int32_t)(u32Time - u32Previous), u8Address);
+    if(u8Event < SHT40X_LOG_INIT)
+        errors[u8Address]++;
+    else
+        infos[u8Address]++;
+
+    if(pFormat == NULL)
+    {
+        printf("event 0x%02X, argument 0x%04X\n", u8Event, u16Argument);
+        return;
+    }
+    printf(pFormat, (unsigned)u16Argument);
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t pDump[DECODE_DUMP_MAX];
+    uint16_t u16EntrySize;
+    uint16_t u16Count;
+    uint32_t u32Previous = 0;
+    unsigned long index;
+
+    if(decode_read(argc, argv, SHT40X_LOG_MAGIC, SHT40X_LOG_ENTRY_SIZE, "log", pDump, &u16EntrySize, &u16Count) != 0)
+        return 1;
+
+    printf("%lu entries, %lu older entries overwritten\n\n", (unsigned long)u16Count, (unsigned long)decode_get32(&pDump[12]));
+    printf("%10s %7s  %-4s  %s\n", "time_ms", "dt", "addr", "message");
+    for(index = 0; index < u16Count; index++)
+    {
+        const uint8_t *pEntry = &pDump[SHT40X_LOG_HEADER_SIZE + (index * u16EntrySize)];
+
+        decode_event(pEntry, u32Previous, index == 0);
+        u32Previous = decode_get32(&pEntry[0]);
+    }
+
+    printf("\n%-6s %8s %8s\n", "addr", "errors", "info");
+    for(index = 0; index < 128; index++)
+    {
+        if((errors[index] + infos[index]) == 0)
+            continue;
+        printf("0x%02lX   %8lu %8lu\n", index, errors[index], infos[index]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,1632 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_test.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 10:40 PM
+ */
+
+/**
+ * Host test of the driver against the virtual device, the virtual clock and the scripted
+ * transport.
+ *
+ * Build with the sht40x_test Code::Blocks project (Linux, gcc, -pthread), Debug_asan adds
+ * the address and undefined behaviour sanitizers to catch out of range indexes and
+ * Debug_options turns on the optional driver features their cases need. Every case runs
+ * on the virtual clock and takes no real time, except the async case which drives the
+ * worker thread transport and the linux case which drives the i2c-dev transport through a
+ * stand-in ioctl, both on the monotonic clock.
+ *
+ * usage: sht40x_test
+ *
+ * Prints one line per case and every failed check, exit code 1 when a check failed.
+ */
+
+#define _GNU_SOURCE
+#include <time.h>
+#ifdef __linux__
+#include <errno.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#endif // __linux__
+#include "../sht40x_driver.h"
+#include "../sht40x_driver_async_thread.h"
+#include "../sht40x_driver_basic.h"
+#include "../sht40x_driver_clock.h"
+#include "../sht40x_driver_filter.h"
+#include "../sht40x_driver_fleet.h"
+#include "../sht40x_driver_linux.h"
+#include "../sht40x_driver_lut.h"
+#include "../sht40x_driver_mock.h"
+#include "../sht40x_driver_mux.h"
+#include "../sht40x_driver_sampler.h"
+#include "../sht40x_driver_sim.h"
+#ifdef SHT40X_ALARM
+#include "../sht40x_driver_alarm.h"
+#endif // SHT40X_ALARM
+#ifdef SHT40X_LOG
+#include "../sht40x_driver_log.h"
+#endif // SHT40X_LOG
+#ifdef SHT40X_TRACE
+#include "../sht40x_driver_trace.h"
+#endif // SHT40X_TRACE
+
+#define TEST_SENSORS                3U                  /**< virtual devices on the test bus */
+#define TEST_POLL_CALLS_MAX         100000UL            /**< sht40x_poll calls before an operation is declared stuck */
+#define TEST_ASYNC_MEASUREMENTS     10U                 /**< chained async measurements */
+#define TEST_LINUX_FD               1000                /**< descriptor of the i2c-dev adapter served by the sim bus */
+#define TEST_RING_SIZE              4U                  /**< samples in the sampler ring */
+#define TEST_TRACE_SIZE             4U                  /**< entries in the trace ring */
+#define TEST_LOG_SIZE               4U                  /**< entries in the log ring */
+#define TEST_DECODE_TEXT_MAX        4096U               /**< decoder output kept */
+#define TEST_MUX_SWITCHES           2U                  /**< switches at 0x70 and 0x71 on the upstream bus */
+#define TEST_MUX_CHANNELS           3U                  /**< channels wired on each switch */
+
+#define TEST_CHECK(condition)       test_check((condition) ? 1 : 0, #condition, __LINE__)
+
+static unsigned long checks;                            /**< checks run */
+static unsigned long failures;                          /**< checks failed */
+
+static sht40x_vclock_t test_clock;                      /**< time base of the sim cases */
+static sht40x_sim_device_t test_devices[TEST_SENSORS];
+static sht40x_sim_bus_t test_bus;
+static sht40x_handle_t test_handles[TEST_SENSORS];
+
+static uint8_t heater_calls;                            /**< heater callback calls */
+static uint8_t heater_status;                           /**< status of the last heater callback */
+static sht40x_data_t *heater_data;                      /**< data of the last heater callback */
+static uint8_t linux_flaky_read;                        /**< 0x45 NACKs the next batched read only */
+static sht40x_sim_device_t mux_devices[TEST_MUX_SWITCHES][TEST_MUX_CHANNELS][2];   /**< 0x44 and 0x45 on every channel */
+static sht40x_sim_bus_t mux_buses[TEST_MUX_SWITCHES][TEST_MUX_CHANNELS];           /**< downstream bus of every channel */
+static uint8_t mux_control[TEST_MUX_SWITCHES];                                      /**< control register of the switches */
+static uint32_t mux_collisions;                                                     /**< transfers seen by more than one channel */
+
+/**
+ * @brief     account one check
+ * @param[in] ok is 1 when the check passed
+ * @param[in] pText is the checked expression
+ * @param[in] line is the source line of the check
+ */
+static void test_check(int ok, const char *pText, int line)
+{
+    checks++;
+    if(!ok)
+    {
+        failures++;
+        printf("    FAIL line %d: %s\n", line, pText);
+    }
+}
+
+/**
+ * @brief debug print, the failures of the driver are expected in several cases
+ */
+static void test_print(char *fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief delay of the handles without a clock, advances the sim bus clock
+ */
+static void test_delay_ms(uint32_t u32Ms)
+{
+    sht40x_sim_advance_us(&test_bus, u32Ms * 1000UL);
+}
+
+/**
+ * @brief heater completion, counts the calls
+ */
+static void test_heater_callback(sht40x_handle_t *pHandle, uint8_t u8Status, sht40x_data_t *pData)
+{
+    (void)pHandle;
+    heater_calls++;
+    heater_status = u8Status;
+    heater_data = pData;
+}
+
+/**
+ * @brief     link a handle to the test bus
+ * @param[in] *pHandle points to the handle
+ * @param[in] u8Address is the sensor address
+ * @param[in] u8Clock is 1 to link the virtual clock, 0 to leave the handle without a time source
+ */
+static void test_link(sht40x_handle_t *pHandle, uint8_t u8Address, uint8_t u8Clock)
+{
+    DRIVER_SHT40X_LINK_INIT(pHandle, sht40x_handle_t);
+    DRIVER_SHT40X_LINK_I2C_INIT(pHandle, sht40x_sim_i2c_init);
+    DRIVER_SHT40X_LINK_I2C_DEINIT(pHandle, sht40x_sim_i2c_deinit);
+    DRIVER_SHT40X_LINK_I2C_READ(pHandle, sht40x_sim_i2c_read);
+    DRIVER_SHT40X_LINK_I2C_WRITE(pHandle, sht40x_sim_i2c_write);
+    DRIVER_SHT40X_LINK_I2C_BUS(pHandle, &test_bus);
+    DRIVER_SHT40X_LINK_DELAY_MS(pHandle, test_delay_ms);
+    DRIVER_SHT40X_LINK_DEBUG_PRINT(pHandle, test_print);
+    if(u8Clock == 1)
+    {
+        DRIVER_SHT40X_LINK_CLOCK(pHandle, &test_clock, sht40x_vclock_now_ms, sht40x_vclock_delay_ms);
+    }
+    pHandle->i2c_address = u8Address;
+}
+
+/**
+ * @brief     reset the sim bus with TEST_SENSORS devices at 0x44, 0x45 and 0x46 and link the handles
+ * @param[in] u8Clock is 1 to run the bus and the handles on the virtual clock, 0 for the internal sim clock
+ */
+static void test_setup(uint8_t u8Clock)
+{
+    uint8_t index;
+
+    (void)sht40x_vclock_init(&test_clock, 0);
+    for(index = 0; index < TEST_SENSORS; index++)
+    {
+        (void)sht40x_sim_device_init(&test_devices[index], (uint8_t)(0x44 + index), 0x10000000UL * (index + 1U));
+        test_devices[index].temperature_mC = 20000L + (5000L * index);
+        test_devices[index].humidity_mRH = 40000L + (10000L * index);
+    }
+    (void)sht40x_sim_bus_init(&test_bus, test_devices, TEST_SENSORS);
+    if(u8Clock == 1)
+    {
+        test_bus.now_us = sht40x_vclock_now_us;
+        test_bus.pContext = &test_clock;
+    }
+
+    for(index = 0; index < TEST_SENSORS; index++)
+    {
+        test_link(&test_handles[index], (uint8_t)(0x44 + index), u8Clock);
+        (void)sht40x_init(&test_handles[index]);
+    }
+    heater_calls = 0;
+}
+
+/**
+ * @brief     tell whether a measurement matches the device within a tolerance
+ * @param[in] *pData points to the converted data
+ * @param[in] *pDevice points to the device that was measured
+ * @param[in] i32Rise_mC is the expected temperature rise above ambient
+ * @return    1 when both quantities are within 0.1 C and 0.1 %RH
+ */
+static int test_near(const sht40x_data_t *pData, const sht40x_sim_device_t *pDevice, int32_t i32Rise_mC)
+{
+    int32_t i32Temperature = sht40x_temperature_mC(pData) - (pDevice->temperature_mC + i32Rise_mC);
+    int32_t i32Humidity = sht40x_humidity_mRH(pData) - pDevice->humidity_mRH;
+
+    return (i32Temperature > -100) && (i32Temperature < 100) && (i32Humidity > -100) && (i32Humidity < 100);
+}
+
+/**
+ * @brief blocking measurement, serial number, raw ticks, soft reset and CRC error
+ */
+static void test_blocking(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_data_t data;
+    sht40x_ticks_t ticks;
+    uint32_t u32Serial = 0;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK(test_near(&data, &test_devices[0], 0));
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_LOWEST, &data) == 0);
+    TEST_CHECK(sht40x_read_ticks(pHandle, SHT40X_PRECISION_MIDIUM, &ticks) == 0);
+    TEST_CHECK(sht40x_convert_ticks(ticks.temperature, ticks.humidity, &data) == 0);
+    TEST_CHECK(test_near(&data, &test_devices[0], 0));
+    TEST_CHECK(sht40x_get_serial_number(pHandle, &u32Serial) == 0);
+    TEST_CHECK(u32Serial == test_devices[0].serial);
+    TEST_CHECK(sht40x_soft_reset(pHandle) == 0);
+    TEST_CHECK(test_devices[0].resets == 1);
+
+    test_devices[0].crc_error_every = 1;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == SHT40X_DRV_ERR_CRC);
+    test_devices[0].crc_error_every = 0;
+
+    test_devices[0].present = 0;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 1);
+    test_devices[0].present = 1;
+}
+
+/**
+ * @brief split-phase measurement with and without ready polling
+ */
+static void test_split_phase(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_data_t data;
+    sht40x_ticks_t ticks;
+    uint8_t u8Learned = 0;
+    unsigned long polls;
+    uint8_t err;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == 1);      /**< nothing started */
+    TEST_CHECK(sht40x_start_measurement(pHandle, (sht40x_precision_t)(SHT40X_PRECISION_LOWEST + 1)) == 1);
+    TEST_CHECK(sht40x_read_ticks(pHandle, (sht40x_precision_t)(SHT40X_PRECISION_LOWEST + 1), &ticks) == 1);
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_TRUE) == 0);
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, (sht40x_precision_t)0xFF, &data) == 1);
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_FALSE) == 0);
+    TEST_CHECK(test_devices[0].commands == 0);                      /**< nothing reached the bus */
+    TEST_CHECK(sht40x_start_measurement(pHandle, SHT40X_PRECISION_HIGH) == 0);
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(test_devices[0].reads == 0);                         /**< bus untouched before the max time */
+    sht40x_vclock_advance_us(&test_clock, MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] * 1000UL);
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == 0);
+    TEST_CHECK(test_near(&data, &test_devices[0], 0));
+
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_TRUE) == 0);
+    TEST_CHECK(sht40x_start_measurement(pHandle, SHT40X_PRECISION_HIGH) == 0);
+    for(polls = 0; polls < 100; polls++)
+    {
+        err = sht40x_fetch_measurement(pHandle, &data);
+        if(err != SHT40X_DRV_NOT_READY)
+            break;
+        sht40x_vclock_advance_us(&test_clock, MEASUREMENT_POLL_DELAY * 1000UL);
+    }
+    TEST_CHECK(err == 0);
+    TEST_CHECK(sht40x_get_conversion_time(pHandle, SHT40X_PRECISION_HIGH, &u8Learned) == 0);
+    TEST_CHECK((u8Learned * 1000UL >= SHT40X_SIM_CONVERSION_HIGH_US) && (u8Learned <= MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH]));
+
+    /** without any time source a dead sensor must still end the NACK window */
+    test_setup(0);
+    pHandle = &test_handles[0];
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_TRUE) == 0);
+    TEST_CHECK(sht40x_start_measurement(pHandle, SHT40X_PRECISION_HIGH) == 0);
+    test_devices[0].present = 0;
+    for(polls = 0; polls < 1000; polls++)
+    {
+        err = sht40x_fetch_measurement(pHandle, &data);
+        if(err != SHT40X_DRV_NOT_READY)
+            break;
+    }
+    TEST_CHECK(err == 1);
+}
+
+/**
+ * @brief blocking and split-phase heater, completion callback
+ */
+static void test_heater(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[1];
+    sht40x_data_t data;
+    unsigned long polls;
+    uint32_t u32Commands;
+    uint8_t err;
+
+    test_setup(1);
+    DRIVER_SHT40X_LINK_HEATER_CALLBACK(pHandle, test_heater_callback);
+    TEST_CHECK(sht40x_activate_heater(pHandle, SHT40X_HEATER_POWER_200mW_1S, &data) == 0);
+    TEST_CHECK(test_near(&data, &test_devices[1], test_devices[1].heater_rise_mC));
+
+    TEST_CHECK(sht40x_fetch_heater(pHandle, &data) == 1);           /**< nothing started */
+    heater_calls = 0;
+    TEST_CHECK(sht40x_start_heater(pHandle, SHT40X_HEATER_POWER_200mW_100mS) == 0);
+    TEST_CHECK(sht40x_fetch_heater(pHandle, &data) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(heater_calls == 0);
+    sht40x_vclock_advance_us(&test_clock, HEATER_DELAY[SHT40X_HEATER_POWER_200mW_100mS] * 1000UL);
+    TEST_CHECK(sht40x_fetch_heater(pHandle, &data) == 0);
+    TEST_CHECK((heater_calls == 1) && (heater_status == 0) && (heater_data == &data));
+
+    /** without any time source a dead sensor must still end the NACK window */
+    test_setup(0);
+    pHandle = &test_handles[1];
+    DRIVER_SHT40X_LINK_HEATER_CALLBACK(pHandle, test_heater_callback);
+    TEST_CHECK(sht40x_start_heater(pHandle, SHT40X_HEATER_POWER_200mW_1S) == 0);
+    test_devices[1].present = 0;
+    for(polls = 0; polls < 100000UL; polls++)
+    {
+        err = sht40x_fetch_heater(pHandle, &data);
+        if(err != SHT40X_DRV_NOT_READY)
+            break;
+    }
+    TEST_CHECK(err == 1);
+    TEST_CHECK((heater_calls == 1) && (heater_status == 1) && (heater_data == NULL));
+
+    test_devices[1].present = 1;
+    u32Commands = test_devices[1].commands;
+    TEST_CHECK(sht40x_start_heater(pHandle, SHT40X_HEATER_POWER_20mW_100mS + 1) == 1);
+    TEST_CHECK(sht40x_activate_heater(pHandle, SHT40X_HEATER_POWER_20mW_100mS + 1, &data) == 1);
+    TEST_CHECK(test_devices[1].commands == u32Commands);          /**< nothing sent */
+}
+
+/**
+ * @brief pipelined group read, one sensor missing
+ */
+static void test_group(void)
+{
+    sht40x_handle_t *const pHandles[TEST_SENSORS] = { &test_handles[0], &test_handles[1], &test_handles[2] };
+    sht40x_data_t data[TEST_SENSORS];
+    uint8_t pStatus[TEST_SENSORS];
+    uint8_t index;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_group_get_temp_rh(pHandles, TEST_SENSORS, SHT40X_PRECISION_HIGH, data, pStatus) == 0);
+    for(index = 0; index < TEST_SENSORS; index++)
+    {
+        TEST_CHECK(pStatus[index] == 0);
+        TEST_CHECK(test_near(&data[index], &test_devices[index], 0));
+    }
+    TEST_CHECK(test_clock.now_us < 2UL * MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] * 1000UL);   /**< conversions overlapped */
+
+    test_devices[1].present = 0;
+    TEST_CHECK(sht40x_group_get_temp_rh(pHandles, TEST_SENSORS, SHT40X_PRECISION_HIGH, data, pStatus) == 1);
+    TEST_CHECK((pStatus[0] == 0) && (pStatus[1] == 1) && (pStatus[2] == 0));
+    TEST_CHECK(test_near(&data[2], &test_devices[2], 0));
+}
+
+/**
+ * @brief fleet enumeration over two buses, sorted table, duplicate serial, full table and lookups
+ */
+static void test_fleet(void)
+{
+    const sht40x_variant_t pVariants[2] = { SHT40_AD1B_VARIANT, SHT40_BD1B_VARIANT };     /**< 0x44 and 0x45 */
+    sht40x_sim_device_t devices[2];
+    sht40x_sim_bus_t bus;
+    void *const pBuses[2] = { &test_bus, &bus };
+    sht40x_handle_t template;
+    sht40x_handle_t handles[4];
+    sht40x_fleet_entry_t table[4];
+    sht40x_fleet_t fleet;
+    sht40x_handle_t *pHandle = NULL;
+    sht40x_data_t data;
+    uint32_t u32Commands;
+    uint32_t u32Serial = 0;
+    uint8_t index;
+
+    test_setup(1);
+    test_devices[0].serial = 0x30000000UL;
+    test_devices[1].serial = 0x10000000UL;
+    (void)sht40x_sim_device_init(&devices[0], 0x44, 0x20000000UL);
+    (void)sht40x_sim_device_init(&devices[1], 0x45, 0x10000000UL);      /**< the 0x45 of the first bus, seen through a bridge */
+    devices[0].temperature_mC = 30000L;
+    (void)sht40x_sim_bus_init(&bus, devices, 2);
+    bus.now_us = sht40x_vclock_now_us;
+    bus.pContext = &test_clock;
+    memset(&template, 0, sizeof(template));
+    test_link(&template, 0x44, 1);
+
+    TEST_CHECK(sht40x_fleet_init(&fleet, NULL, table, 4) == 2);
+    TEST_CHECK(sht40x_fleet_init(&fleet, handles, table, 4) == 0);
+    TEST_CHECK(sht40x_fleet_enumerate(&fleet, NULL, pBuses, 2, pVariants, 2) == 2);
+    TEST_CHECK(sht40x_fleet_enumerate(&fleet, &template, pBuses, 2, pVariants, 2) == 0);
+    TEST_CHECK((fleet.count == 3) && (fleet.probes == 4) && (fleet.duplicates == 1));
+    TEST_CHECK((table[0].serial == 0x10000000UL) && (table[1].serial == 0x20000000UL) && (table[2].serial == 0x30000000UL));
+
+    /** every serial finds the handle of its device, left initialized with the serial cached */
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x20000000UL, NULL) == 2);
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x20000001UL, &pHandle) == 1);
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x00000000UL, &pHandle) == 1);
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x20000000UL, &pHandle) == 0);
+    TEST_CHECK((pHandle != NULL) && (pHandle->i2c_bus == &bus) && (pHandle->i2c_address == 0x44));
+    u32Commands = devices[0].commands;
+    TEST_CHECK(sht40x_get_serial_number(pHandle, &u32Serial) == 0);
+    TEST_CHECK((u32Serial == 0x20000000UL) && (devices[0].commands == u32Commands));      /**< no bus traffic */
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK(test_near(&data, &devices[0], 0));
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x10000000UL, &pHandle) == 0);
+    TEST_CHECK((pHandle->i2c_bus == &test_bus) && (pHandle->i2c_address == 0x45));       /**< the first probe is kept */
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x30000000UL, &pHandle) == 0);
+    TEST_CHECK((pHandle->i2c_bus == &test_bus) && (pHandle->i2c_address == 0x44));
+    for(index = 0; index < fleet.count; index++)
+    {
+        u32Commands = test_devices[0].commands + test_devices[1].commands + devices[0].commands + devices[1].commands;
+        TEST_CHECK(sht40x_get_serial_number(table[index].pHandle, &u32Serial) == 0);
+        TEST_CHECK(u32Serial == table[index].serial);
+        TEST_CHECK(test_devices[0].commands + test_devices[1].commands + devices[0].commands + devices[1].commands == u32Commands);
+    }
+
+    /** a full table stops the enumeration and keeps what it found sorted */
+    TEST_CHECK(sht40x_fleet_init(&fleet, handles, table, 2) == 0);
+    TEST_CHECK(sht40x_fleet_enumerate(&fleet, &template, pBuses, 2, pVariants, 2) == 1);
+    TEST_CHECK((fleet.count == 2) && (fleet.probes == 2));
+    TEST_CHECK((table[0].serial == 0x10000000UL) && (table[1].serial == 0x30000000UL));
+    TEST_CHECK(sht40x_fleet_find(&fleet, 0x20000000UL, &pHandle) == 1);
+}
+
+/**
+ * @brief     find the channel connected to the upstream bus
+ * @return    downstream bus, NULL when no channel or several channels are connected
+ */
+static sht40x_sim_bus_t *test_mux_route(void)
+{
+    sht40x_sim_bus_t *pRoute = NULL;
+    uint8_t u8Connected = 0;
+    uint8_t u8Switch;
+    uint8_t u8Channel;
+
+    for(u8Switch = 0; u8Switch < TEST_MUX_SWITCHES; u8Switch++)
+    {
+        for(u8Channel = 0; u8Channel < TEST_MUX_CHANNELS; u8Channel++)
+        {
+            if((mux_control[u8Switch] & (1U << u8Channel)) != 0)
+            {
+                pRoute = &mux_buses[u8Switch][u8Channel];
+                u8Connected++;
+            }
+        }
+    }
+    if(u8Connected > 1)
+        mux_collisions++;       /**< sensors sharing an address would answer together */
+    return (u8Connected == 1) ? pRoute : NULL;
+}
+
+/**
+ * @brief      upstream i2c read, the switches at 0x70 and 0x71 return their control register
+ * @param[in]  *pBus is unused, the switches and the channels are global
+ * @param[in]  addr is the 7 bit address
+ * @param[out] *pBuf points to the data
+ * @param[in]  u8Length is the number of bytes
+ * @return     0 on ACK, 1 when nothing or several channels answer
+ */
+static uint8_t test_mux_upstream_read(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_sim_bus_t *pRoute;
+
+    (void)pBus;
+    if((addr >= SHT40X_MUX_ADDRESS_MIN) && (addr < SHT40X_MUX_ADDRESS_MIN + TEST_MUX_SWITCHES))
+    {
+        memset(pBuf, mux_control[addr - SHT40X_MUX_ADDRESS_MIN], u8Length);
+        return 0;
+    }
+    pRoute = test_mux_route();
+    return (pRoute == NULL) ? 1 : sht40x_sim_i2c_read(pRoute, addr, pBuf, u8Length);
+}
+
+/**
+ * @brief      upstream i2c write, the switches at 0x70 and 0x71 take a one byte control register
+ * @param[in]  *pBus is unused, the switches and the channels are global
+ * @param[in]  addr is the 7 bit address
+ * @param[in] *pBuf points to the data
+ * @param[in]  u8Length is the number of bytes
+ * @return     0 on ACK, 1 when nothing or several channels answer
+ */
+static uint8_t test_mux_upstream_write(void *pBus, uint8_t addr, uint8_t *pBuf, uint8_t u8Length)
+{
+    sht40x_sim_bus_t *pRoute;
+
+    (void)pBus;
+    if((addr >= SHT40X_MUX_ADDRESS_MIN) && (addr < SHT40X_MUX_ADDRESS_MIN + TEST_MUX_SWITCHES))
+    {
+        if(u8Length != 1)
+            return 1;
+        mux_control[addr - SHT40X_MUX_ADDRESS_MIN] = pBuf[0];
+        return 0;
+    }
+    pRoute = test_mux_route();
+    return (pRoute == NULL) ? 1 : sht40x_sim_i2c_write(pRoute, addr, pBuf, u8Length);
+}
+
+/**
+ * @brief switched group reads: selects per round on one switch, peer release on a shared bus
+ */
+static void test_mux(void)
+{
+    sht40x_mux_t muxes[TEST_MUX_SWITCHES];
+    sht40x_mux_t *const pMuxes[TEST_MUX_SWITCHES] = { &muxes[0], &muxes[1] };
+    sht40x_mux_port_t ports[TEST_MUX_SWITCHES][TEST_MUX_CHANNELS];
+    sht40x_handle_t handles[TEST_MUX_CHANNELS * 2];
+    sht40x_handle_t *pHandles[TEST_MUX_CHANNELS * 2];
+    sht40x_data_t data[TEST_MUX_CHANNELS * 2];
+    uint8_t pStatus[TEST_MUX_CHANNELS * 2];
+    uint8_t u8Switch;
+    uint8_t u8Channel;
+    uint8_t index;
+
+    test_setup(1);
+    memset(mux_control, 0, sizeof(mux_control));
+    mux_collisions = 0;
+    for(u8Switch = 0; u8Switch < TEST_MUX_SWITCHES; u8Switch++)
+    {
+        TEST_CHECK(sht40x_mux_init(&muxes[u8Switch], NULL, test_mux_upstream_read, test_mux_upstream_write,
+                                   (uint8_t)(SHT40X_MUX_ADDRESS_MIN + u8Switch)) == 0);
+        for(u8Channel = 0; u8Channel < TEST_MUX_CHANNELS; u8Channel++)
+        {
+            for(index = 0; index < 2; index++)
+            {
+                (void)sht40x_sim_device_init(&mux_devices[u8Switch][u8Channel][index], (uint8_t)(0x44 + index),
+                                             0x01000000UL * ((u8Switch * TEST_MUX_CHANNELS * 2U) + (u8Channel * 2U) + index + 1U));
+                mux_devices[u8Switch][u8Channel][index].temperature_mC = 10000L + (1000L * ((u8Switch * TEST_MUX_CHANNELS * 2) + (u8Channel * 2) + index));
+            }
+            (void)sht40x_sim_bus_init(&mux_buses[u8Switch][u8Channel], mux_devices[u8Switch][u8Channel], 2);
+            mux_buses[u8Switch][u8Channel].now_us = sht40x_vclock_now_us;
+            mux_buses[u8Switch][u8Channel].pContext = &test_clock;
+            TEST_CHECK(sht40x_mux_port_init(&ports[u8Switch][u8Channel], &muxes[u8Switch], u8Channel) == 0);
+        }
+    }
+    TEST_CHECK(sht40x_mux_init(&muxes[0], NULL, test_mux_upstream_read, test_mux_upstream_write, 0x6F) == 1);
+    TEST_CHECK(sht40x_mux_port_init(&ports[0][0], &muxes[0], SHT40X_MUX_CHANNELS) == 1);
+
+    /** two sensors on each channel of one switch, listed channel after channel */
+    for(index = 0; index < TEST_MUX_CHANNELS * 2; index++)
+    {
+        test_link(&handles[index], (uint8_t)(0x44 + (index / TEST_MUX_CHANNELS)), 1);
+        DRIVER_SHT40X_LINK_I2C_INIT(&handles[index], sht40x_mux_i2c_init);
+        DRIVER_SHT40X_LINK_I2C_DEINIT(&handles[index], sht40x_mux_i2c_deinit);
+        DRIVER_SHT40X_LINK_I2C_READ(&handles[index], sht40x_mux_i2c_read);
+        DRIVER_SHT40X_LINK_I2C_WRITE(&handles[index], sht40x_mux_i2c_write);
+        DRIVER_SHT40X_LINK_I2C_BUS(&handles[index], &ports[0][index % TEST_MUX_CHANNELS]);
+        TEST_CHECK(sht40x_init(&handles[index]) == 0);
+        pHandles[index] = &handles[index];
+    }
+    TEST_CHECK(sht40x_mux_release(&muxes[0]) == 0);
+    muxes[0].switches = 0;
+    TEST_CHECK(sht40x_mux_group_get_temp_rh(pHandles, TEST_MUX_CHANNELS * 2, SHT40X_PRECISION_HIGH, data, pStatus) == 0);
+    for(index = 0; index < TEST_MUX_CHANNELS * 2; index++)
+    {
+        TEST_CHECK(pStatus[index] == 0);
+        TEST_CHECK(test_near(&data[index], &mux_devices[0][index % TEST_MUX_CHANNELS][index / TEST_MUX_CHANNELS], 0));
+    }
+    TEST_CHECK(muxes[0].switches == (2U * TEST_MUX_CHANNELS) - 1U);      /**< one select per channel started, one per channel read back but the last */
+    TEST_CHECK(mux_collisions == 0);
+
+    /** 0x44 behind both switches, the peer is disconnected before each select */
+    TEST_CHECK(sht40x_mux_share_bus(pMuxes, TEST_MUX_SWITCHES) == 0);
+    DRIVER_SHT40X_LINK_I2C_BUS(&handles[1], &ports[1][0]);
+    TEST_CHECK(sht40x_init(&handles[1]) == 0);
+    pHandles[0] = &handles[1];              /**< listed out of switch order */
+    pHandles[1] = &handles[0];
+    TEST_CHECK(sht40x_mux_release(&muxes[0]) == 0);
+    TEST_CHECK(sht40x_mux_release(&muxes[1]) == 0);
+    muxes[0].switches = 0;
+    muxes[1].switches = 0;
+    TEST_CHECK(sht40x_mux_group_get_temp_rh(pHandles, 2, SHT40X_PRECISION_HIGH, data, pStatus) == 0);
+    TEST_CHECK((pStatus[0] == 0) && (pStatus[1] == 0));
+    TEST_CHECK(test_near(&data[0], &mux_devices[1][0][0], 0));
+    TEST_CHECK(test_near(&data[1], &mux_devices[0][0][0], 0));
+    TEST_CHECK(muxes[0].switches + muxes[1].switches == ((2U * 2U) - 1U) + 2U);     /**< 3 selects, a release on each move */
+    TEST_CHECK(mux_collisions == 0);
+}
+
+/**
+ * @brief     run sht40x_poll on the virtual clock until the queued operation finished
+ * @param[in] *pHandle points to the handle
+ * @return    status of the operation
+ * @note      checks that no call runs more than one transfer
+ */
+static uint8_t test_poll_run(sht40x_handle_t *pHandle)
+{
+    uint32_t u32Next = 0;
+    uint32_t u32Now;
+    uint32_t u32Transfers;
+    unsigned long calls;
+    uint8_t err = SHT40X_DRV_NOT_READY;
+
+    for(calls = 0; (calls < TEST_POLL_CALLS_MAX) && (err == SHT40X_DRV_NOT_READY); calls++)
+    {
+        u32Now = sht40x_vclock_now_ms(&test_clock);
+        u32Transfers = test_bus.transfers;
+        err = sht40x_poll(pHandle, u32Now, &u32Next);
+        TEST_CHECK(test_bus.transfers - u32Transfers <= 1);
+        if((err == SHT40X_DRV_NOT_READY) && ((int32_t)(u32Next - u32Now) > 0))
+            sht40x_vclock_advance_us(&test_clock, (u32Next - u32Now) * 1000UL);
+    }
+    return err;
+}
+
+/**
+ * @brief superloop state machine: init, measure, heater, serial number and reset
+ */
+static void test_poll(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[1];
+    sht40x_ticks_t ticks;
+    sht40x_data_t data;
+    uint32_t u32Resets;
+
+    test_setup(1);
+    test_link(pHandle, 0, 1);           /**< linked only, the variant gives the address */
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_MEASURE, SHT40X_PRECISION_HIGH) == 3);
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_INIT, SHT45_AD1B_VARIANT + 1) == 1);
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_INIT, SHT40_BD1B_VARIANT) == 0);
+    TEST_CHECK(test_poll_run(pHandle) == 0);
+    TEST_CHECK((pHandle->inited == 1) && (pHandle->i2c_address == 0x45));
+    TEST_CHECK((pHandle->serial_valid == 1) && (pHandle->serial_number == test_devices[1].serial));
+
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_MEASURE, SHT40X_PRECISION_HIGH) == 0);
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_MEASURE, SHT40X_PRECISION_HIGH) == 1);     /**< busy */
+    TEST_CHECK(test_poll_run(pHandle) == 0);
+    TEST_CHECK(sht40x_poll_get_ticks(pHandle, &ticks) == 0);
+    TEST_CHECK(sht40x_convert_ticks(ticks.temperature, ticks.humidity, &data) == 0);
+    TEST_CHECK(test_near(&data, &test_devices[1], 0));
+
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_HEATER, SHT40X_HEATER_POWER_200mW_100mS) == 0);
+    TEST_CHECK(test_poll_run(pHandle) == 0);
+    TEST_CHECK(sht40x_poll_get_ticks(pHandle, &ticks) == 0);
+    TEST_CHECK(sht40x_convert_temperature_mC(ticks.temperature) > test_devices[1].temperature_mC);
+
+    u32Resets = test_devices[1].resets;
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_RESET, 0) == 0);
+    TEST_CHECK(test_poll_run(pHandle) == 0);
+    TEST_CHECK(test_devices[1].resets == u32Resets + 1);
+
+    test_devices[1].present = 0;
+    TEST_CHECK(sht40x_poll_begin(pHandle, SHT40X_POLL_MEASURE, SHT40X_PRECISION_HIGH) == 0);
+    TEST_CHECK(test_poll_run(pHandle) == 1);
+    TEST_CHECK(sht40x_poll_get_ticks(pHandle, &ticks) == 1);
+}
+
+/**
+ * @brief scripted transfers of a blocking measurement, NACKed read
+ */
+static void test_mock(void)
+{
+    sht40x_mock_t mock;
+    sht40x_handle_t handle;
+    sht40x_data_t data;
+
+    test_setup(1);
+    (void)sht40x_mock_init(&mock, 0);
+    (void)sht40x_mock_expect_measurement(&mock, 0x44, READ_PRECISION[SHT40X_PRECISION_HIGH], 0x6666, 0x8000);
+    (void)sht40x_mock_expect_write(&mock, 0x44, READ_PRECISION[SHT40X_PRECISION_HIGH], 0);
+    (void)sht40x_mock_expect_read(&mock, 0x44, NULL, RESPONSE_LENGTH, 1);
+
+    test_link(&handle, 0x44, 1);
+    DRIVER_SHT40X_LINK_I2C_INIT(&handle, sht40x_mock_i2c_init);
+    DRIVER_SHT40X_LINK_I2C_DEINIT(&handle, sht40x_mock_i2c_deinit);
+    DRIVER_SHT40X_LINK_I2C_READ(&handle, sht40x_mock_i2c_read);
+    DRIVER_SHT40X_LINK_I2C_WRITE(&handle, sht40x_mock_i2c_write);
+    DRIVER_SHT40X_LINK_I2C_BUS(&handle, &mock);
+    TEST_CHECK(sht40x_init(&handle) == 0);
+
+    TEST_CHECK(sht40x_get_temp_rh(&handle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK((data.rawData[0] == 0x66) && (data.rawData[3] == 0x80));
+    TEST_CHECK(sht40x_get_temp_rh(&handle, SHT40X_PRECISION_HIGH, &data) == 1);
+    TEST_CHECK(sht40x_mock_verify(&mock) == 0);
+}
+
+#ifdef SHT40X_STATS
+/**
+ * @brief counters of a handle: commands, bytes, busy NACKs, CRC errors, waits and latency
+ */
+static void test_stats(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_stats_t stats;
+    sht40x_data_t data;
+    uint32_t u32Serial;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_get_stats(NULL, &stats) == 2);
+    TEST_CHECK(sht40x_get_stats(pHandle, NULL) == 2);
+    TEST_CHECK(sht40x_reset_stats(NULL) == 2);
+    TEST_CHECK(sht40x_get_stats(pHandle, &stats) == 0);
+    TEST_CHECK((stats.calls == 0) && (stats.bytes_written == 0) && (stats.latency_min_ms == 0xFFFF));
+
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_LOWEST, &data) == 0);
+    TEST_CHECK(sht40x_activate_heater(pHandle, SHT40X_HEATER_POWER_110mW_100mS, &data) == 0);
+    TEST_CHECK(sht40x_get_serial_number(pHandle, &u32Serial) == 0);
+    TEST_CHECK(sht40x_soft_reset(pHandle) == 0);
+    TEST_CHECK(sht40x_get_stats(pHandle, &stats) == 0);
+    TEST_CHECK((stats.cmd_measure[SHT40X_PRECISION_HIGH] == 1) && (stats.cmd_measure[SHT40X_PRECISION_MIDIUM] == 0) &&
+               (stats.cmd_measure[SHT40X_PRECISION_LOWEST] == 1));
+    TEST_CHECK((stats.cmd_heater[SHT40X_HEATER_POWER_110mW_100mS] == 1) && (stats.cmd_heater[SHT40X_HEATER_POWER_200mW_1S] == 0));
+    TEST_CHECK((stats.cmd_serial == 1) && (stats.cmd_reset == 1));
+    TEST_CHECK((stats.bytes_written == 5) && (stats.bytes_read == 4U * RESPONSE_LENGTH));
+    TEST_CHECK((stats.transport_errors == 0) && (stats.busy_nacks == 0) && (stats.crc_errors == 0));
+    TEST_CHECK(stats.calls == 3);
+    TEST_CHECK(stats.latency_min_ms == MEASUREMENT_DELAY[SHT40X_PRECISION_LOWEST]);
+    TEST_CHECK(stats.latency_max_ms == HEATER_DELAY[SHT40X_HEATER_POWER_110mW_100mS]);
+    TEST_CHECK(stats.latency_total_ms == stats.delay_ms - SERIAL_NUMBER_DELAY - SOFT_RESET_DELAY);
+    TEST_CHECK(stats.delay_ms == MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] + MEASUREMENT_DELAY[SHT40X_PRECISION_LOWEST] +
+               HEATER_DELAY[SHT40X_HEATER_POWER_110mW_100mS] + SERIAL_NUMBER_DELAY + SOFT_RESET_DELAY);
+
+    TEST_CHECK(sht40x_reset_stats(pHandle) == 0);
+    TEST_CHECK(sht40x_get_stats(pHandle, &stats) == 0);
+    TEST_CHECK((stats.cmd_measure[SHT40X_PRECISION_HIGH] == 0) && (stats.delay_ms == 0) && (stats.calls == 0));
+    TEST_CHECK((stats.latency_total_ms == 0) && (stats.latency_max_ms == 0) && (stats.latency_min_ms == 0xFFFF));
+
+    test_devices[0].crc_error_every = 1;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == SHT40X_DRV_ERR_CRC);
+    test_devices[0].crc_error_every = 0;
+    test_devices[0].present = 0;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 1);
+    test_devices[0].present = 1;
+    TEST_CHECK(sht40x_get_stats(pHandle, &stats) == 0);
+    TEST_CHECK((stats.crc_errors == 1) && (stats.transport_errors == 1) && (stats.busy_nacks == 0));
+    TEST_CHECK(stats.cmd_measure[SHT40X_PRECISION_HIGH] == 2);      /**< commands are counted when written, NACKed or not */
+
+    /** polling from 1 ms reads the frame while the device converts: NACKed, counted busy */
+    TEST_CHECK(sht40x_reset_stats(pHandle) == 0);
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_TRUE) == 0);
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK(sht40x_get_stats(pHandle, &stats) == 0);
+    TEST_CHECK((stats.busy_nacks == test_devices[0].nacks) && (stats.busy_nacks > 0));
+    TEST_CHECK(stats.transport_errors == stats.busy_nacks);
+    TEST_CHECK((stats.calls == 1) && (stats.latency_min_ms == stats.latency_max_ms) &&
+               (stats.latency_max_ms == stats.delay_ms));
+    TEST_CHECK(stats.delay_ms == stats.busy_nacks + 1U);        /**< one MEASUREMENT_POLL_DELAY per read */
+}
+#endif // SHT40X_STATS
+
+/**
+ * @brief every raw tick through the tables and the arithmetic conversion
+ */
+static void test_lut(void)
+{
+    int32_t i32Error;
+    int32_t i32Max_mC = 0;
+    int32_t i32Max_mRH = 0;
+    uint32_t u32Ticks;
+    uint32_t u32Full = 0;
+
+    for(u32Ticks = 0; u32Ticks <= 0xFFFFUL; u32Ticks++)
+    {
+        i32Error = sht40x_lut_temperature_mC((uint16_t)u32Ticks) - sht40x_convert_temperature_mC((uint16_t)u32Ticks);
+        i32Error = (i32Error < 0) ? -i32Error : i32Error;
+        i32Max_mC = (i32Error > i32Max_mC) ? i32Error : i32Max_mC;
+        i32Error = sht40x_lut_humidity_mRH((uint16_t)u32Ticks) - sht40x_convert_humidity_mRH((uint16_t)u32Ticks);
+        i32Error = (i32Error < 0) ? -i32Error : i32Error;
+        i32Max_mRH = (i32Error > i32Max_mRH) ? i32Error : i32Max_mRH;
+#ifdef SHT40X_LUT_FULL
+        if((sht40x_lut_full_temperature_mC((uint16_t)u32Ticks) == sht40x_convert_temperature_mC((uint16_t)u32Ticks)) &&
+           (sht40x_lut_full_humidity_mRH((uint16_t)u32Ticks) == sht40x_convert_humidity_mRH((uint16_t)u32Ticks)))
+            u32Full++;
+#endif // SHT40X_LUT_FULL
+    }
+    TEST_CHECK(i32Max_mC <= 1);
+    TEST_CHECK(i32Max_mRH <= 1);
+    TEST_CHECK((SHT40X_CONVERT_T_mC(0) == -45000L) && (SHT40X_CONVERT_T_mF(0) == -49000L));
+    TEST_CHECK((SHT40X_CONVERT_RH_mRH(0) == -6000L) && (sht40x_convert_humidity_mRH(0) == HUMIDITY_MIN_MILLI));
+#ifdef SHT40X_LUT_FULL
+    TEST_CHECK(u32Full == 0x10000UL);       /**< same result on every tick */
+#else
+    (void)u32Full;
+#endif // SHT40X_LUT_FULL
+}
+
+#ifdef SHT40X_ALARM
+static uint8_t alarm_calls;                             /**< alarm callback calls */
+static uint8_t alarm_channel;                           /**< channel of the last alarm callback */
+static uint8_t alarm_state;                             /**< state of the last alarm callback */
+static uint16_t alarm_ticks;                            /**< ticks of the last alarm callback */
+
+/**
+ * @brief     record an alarm state change
+ * @param[in] *pAlarm points to the alarm that changed
+ * @param[in] u8Channel is the channel that changed
+ * @param[in] u8State is the new state
+ * @param[in] u16Ticks is the sample that changed it
+ */
+static void test_alarm_callback(sht40x_alarm_t *pAlarm, uint8_t u8Channel, uint8_t u8State, uint16_t u16Ticks)
+{
+    (void)pAlarm;
+    alarm_calls++;
+    alarm_channel = u8Channel;
+    alarm_state = u8State;
+    alarm_ticks = u16Ticks;
+}
+
+/**
+ * @brief     feed one temperature sample to an alarm
+ * @param[in] *pAlarm points to the alarm
+ * @param[in] u16Ticks is the temperature word, the humidity word sits mid range
+ * @return    temperature state after the sample
+ */
+static uint8_t test_alarm_feed(sht40x_alarm_t *pAlarm, uint16_t u16Ticks)
+{
+    sht40x_ticks_t ticks;
+    sht40x_alarm_state_t state = SHT40X_ALARM_NORMAL;
+
+    ticks.temperature = u16Ticks;
+    ticks.humidity = 0x8000;
+    (void)sht40x_alarm_process(pAlarm, &ticks);
+    (void)sht40x_alarm_get_state(pAlarm, SHT40X_ALARM_TEMPERATURE, &state);
+    return (uint8_t)state;
+}
+
+/**
+ * @brief limits to ticks, hysteresis, debounce, unreachable limits and the measurement hook
+ */
+static void test_alarm(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_alarm_t alarm;
+    sht40x_alarm_limit_t *pLimit = &alarm.channel[SHT40X_ALARM_TEMPERATURE];
+    sht40x_alarm_state_t state;
+    sht40x_data_t data;
+    uint8_t index;
+
+    TEST_CHECK(sht40x_alarm_init(NULL, 1, NULL, NULL) == 2);
+    TEST_CHECK(sht40x_alarm_init(&alarm, 0, test_alarm_callback, NULL) == 0);
+    TEST_CHECK((alarm.debounce == 1) && (pLimit->flags == 0));
+    TEST_CHECK(sht40x_alarm_set_limits(NULL, SHT40X_ALARM_TEMPERATURE, 0, 30000, 1000) == 2);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, (sht40x_alarm_channel_t)2, 0, 30000, 1000) == 1);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, 30000, 0, 1000) == 1);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, 0, 30000, -1) == 1);
+
+    /* every limit lands on the first tick past it, the clear ticks hysteresis further in */
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, 0, 30000, 1000) == 0);
+    TEST_CHECK(pLimit->flags == (SHT40X_ALARM_LOW_ENABLED | SHT40X_ALARM_HIGH_ENABLED));
+    TEST_CHECK((sht40x_convert_temperature_mC(pLimit->high_set) >= 30000) &&
+               (sht40x_convert_temperature_mC((uint16_t)(pLimit->high_set - 1U)) < 30000));
+    TEST_CHECK((sht40x_convert_temperature_mC(pLimit->high_clear) >= 29000) &&
+               (sht40x_convert_temperature_mC((uint16_t)(pLimit->high_clear - 1U)) < 29000));
+    TEST_CHECK((sht40x_convert_temperature_mC(pLimit->low_set) <= 0) &&
+               (sht40x_convert_temperature_mC((uint16_t)(pLimit->low_set + 1U)) > 0));
+    TEST_CHECK((sht40x_convert_temperature_mC(pLimit->low_clear) <= 1000) &&
+               (sht40x_convert_temperature_mC((uint16_t)(pLimit->low_clear + 1U)) > 1000));
+
+    /* hysteresis, a value back under the limit but above limit - hysteresis keeps the alarm */
+    alarm_calls = 0;
+    TEST_CHECK(test_alarm_feed(&alarm, (uint16_t)(pLimit->high_set - 1U)) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_HIGH);
+    TEST_CHECK((alarm_calls == 1) && (alarm_channel == SHT40X_ALARM_TEMPERATURE) &&
+               (alarm_state == SHT40X_ALARM_HIGH) && (alarm_ticks == pLimit->high_set));
+    TEST_CHECK(test_alarm_feed(&alarm, (uint16_t)(pLimit->high_set - 1U)) == SHT40X_ALARM_HIGH);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_clear) == SHT40X_ALARM_HIGH);
+    TEST_CHECK(test_alarm_feed(&alarm, (uint16_t)(pLimit->high_clear - 1U)) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->low_set) == SHT40X_ALARM_LOW);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->low_clear) == SHT40X_ALARM_LOW);
+    TEST_CHECK(test_alarm_feed(&alarm, (uint16_t)(pLimit->low_clear + 1U)) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(alarm_calls == 4);
+
+    /* debounce, an interrupted run starts over */
+    TEST_CHECK(sht40x_alarm_init(&alarm, 3, test_alarm_callback, NULL) == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, 0, 30000, 1000) == 0);
+    alarm_calls = 0;
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, (uint16_t)(pLimit->high_clear - 1U)) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(alarm_calls == 0);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->high_set) == SHT40X_ALARM_HIGH);
+    TEST_CHECK(alarm_calls == 1);
+    for(index = 0; index < 2; index++)
+        TEST_CHECK(test_alarm_feed(&alarm, pLimit->low_set) == SHT40X_ALARM_HIGH);
+    TEST_CHECK(test_alarm_feed(&alarm, pLimit->low_set) == SHT40X_ALARM_LOW);
+    TEST_CHECK((alarm_calls == 2) && (alarm_state == SHT40X_ALARM_LOW));
+
+    /* a limit no tick can reach stays disabled instead of firing on every sample */
+    TEST_CHECK(sht40x_alarm_init(&alarm, 1, test_alarm_callback, NULL) == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, -50000, 200000, 0) == 0);
+    TEST_CHECK(pLimit->flags == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_HUMIDITY, -1, 100001, 0) == 0);
+    TEST_CHECK(alarm.channel[SHT40X_ALARM_HUMIDITY].flags == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_HUMIDITY, SHT40X_ALARM_NO_LOW, SHT40X_ALARM_NO_HIGH, 0) == 0);
+    TEST_CHECK(alarm.channel[SHT40X_ALARM_HUMIDITY].flags == 0);
+    alarm_calls = 0;
+    TEST_CHECK(test_alarm_feed(&alarm, 0x0000) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(test_alarm_feed(&alarm, 0xFFFF) == SHT40X_ALARM_NORMAL);
+    TEST_CHECK(alarm_calls == 0);
+
+    /* the driver runs a linked alarm on every measurement frame */
+    test_setup(1);
+    TEST_CHECK(sht40x_alarm_init(&alarm, 1, test_alarm_callback, NULL) == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_TEMPERATURE, 0, 30000, 1000) == 0);
+    TEST_CHECK(sht40x_alarm_set_limits(&alarm, SHT40X_ALARM_HUMIDITY, 50000, 90000, 1000) == 0);
+    DRIVER_SHT40X_LINK_ALARM(pHandle, &alarm);
+    alarm_calls = 0;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK((alarm_calls == 1) && (alarm_channel == SHT40X_ALARM_HUMIDITY) && (alarm_state == SHT40X_ALARM_LOW));
+    test_devices[0].temperature_mC = 35000L;
+    TEST_CHECK(sht40x_start_measurement(pHandle, SHT40X_PRECISION_HIGH) == 0);
+    sht40x_vclock_advance_us(&test_clock, MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] * 1000UL);
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == 0);
+    TEST_CHECK((alarm_calls == 2) && (alarm_channel == SHT40X_ALARM_TEMPERATURE) && (alarm_state == SHT40X_ALARM_HIGH));
+    TEST_CHECK(sht40x_alarm_get_state(&alarm, SHT40X_ALARM_TEMPERATURE, &state) == 0);
+    TEST_CHECK(state == SHT40X_ALARM_HIGH);
+    test_devices[0].crc_error_every = 1;
+    test_devices[0].temperature_mC = 20000L;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == SHT40X_DRV_ERR_CRC);
+    TEST_CHECK(alarm_calls == 2);           /**< a corrupt frame never reaches the alarm */
+    test_devices[0].crc_error_every = 0;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    TEST_CHECK((alarm_calls == 3) && (alarm_state == SHT40X_ALARM_NORMAL));
+    DRIVER_SHT40X_LINK_ALARM(pHandle, NULL);
+}
+#endif // SHT40X_ALARM
+
+#if defined(__linux__) && (defined(SHT40X_TRACE) || defined(SHT40X_LOG))
+/**
+ * @brief     append a chunk of a dump to a file
+ * @param[in] *pContext is the FILE receiving the dump
+ * @param[in] *pBuf points to the chunk
+ * @param[in] u8Length is the chunk size
+ */
+static void test_dump_output(void *pContext, const uint8_t *pBuf, uint8_t u8Length)
+{
+    (void)fwrite(pBuf, 1, u8Length, (FILE *)pContext);
+}
+
+/**
+ * @brief     run a decoder on a dump and capture what it prints
+ * @param[in] decode is the main function of the decoder, it reads the dump from standard input
+ * @param[in] *pDump is the dump file, decoded from its start
+ * @param[out] *pText points to the buffer receiving the output, NUL terminated
+ * @return    exit code of the decoder, -1 when the redirection failed
+ */
+static int test_decode(int (*decode)(int, char **), FILE *pDump, char *pText)
+{
+    static char name[] = "decode";
+    char *argv[] = {name, NULL};
+    FILE *pOut = tmpfile();
+    int stdin_fd = dup(STDIN_FILENO);
+    int stdout_fd = dup(STDOUT_FILENO);
+    size_t length = 0;
+    int status = -1;
+
+    if((pOut != NULL) && (stdin_fd >= 0) && (stdout_fd >= 0))
+    {
+        fflush(pDump);
+        (void)lseek(fileno(pDump), 0, SEEK_SET);     /**< the descriptor, the FILE may have buffered past the start */
+        fflush(stdout);
+        (void)dup2(fileno(pDump), STDIN_FILENO);
+        (void)dup2(fileno(pOut), STDOUT_FILENO);
+        clearerr(stdin);
+        status = decode(1, argv);
+        fflush(stdout);
+        (void)dup2(stdin_fd, STDIN_FILENO);
+        (void)dup2(stdout_fd, STDOUT_FILENO);
+        clearerr(stdin);
+        rewind(pOut);
+        length = fread(pText, 1, TEST_DECODE_TEXT_MAX - 1U, pOut);
+    }
+    pText[length] = '\0';
+    if(pOut != NULL)
+        fclose(pOut);
+    if(stdin_fd >= 0)
+        close(stdin_fd);
+    if(stdout_fd >= 0)
+        close(stdout_fd);
+    return status;
+}
+
+#endif // __linux__ && (SHT40X_TRACE || SHT40X_LOG)
+
+#if defined(__linux__) && defined(SHT40X_TRACE)
+#define main sht40x_trace_decode_main   /**< the decoder runs in process on the dump */
+#include "sht40x_trace_decode.c"
+#undef main
+
+/**
+ * @brief trace ring: wrap, lost entries, a failed read and a CRC error decoded from the dump
+ */
+static void test_trace(void)
+{
+    static char text[TEST_DECODE_TEXT_MAX];
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_trace_entry_t entries[TEST_TRACE_SIZE];
+    sht40x_trace_entry_t entry;
+    sht40x_trace_t trace;
+    sht40x_data_t data;
+    uint8_t pHeader[SHT40X_TRACE_HEADER_SIZE];
+    char line[64];
+    FILE *pDump;
+    uint8_t index;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_trace_init(NULL, entries, TEST_TRACE_SIZE) == 2);
+    TEST_CHECK(sht40x_trace_init(&trace, entries, TEST_TRACE_SIZE - 1U) == 1);
+    TEST_CHECK(sht40x_trace_init(&trace, entries, TEST_TRACE_SIZE) == 0);
+    TEST_CHECK((sht40x_trace_count(&trace) == 0) && (sht40x_trace_get(&trace, 0, &entry) == 1));
+    DRIVER_SHT40X_LINK_TRACE(pHandle, &trace);
+
+    /** 2 good measurements, then a read NACKed and a frame with a bad CRC, the ring keeps the last 4 */
+    for(index = 0; index < 2; index++)
+    {
+        TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == 0);
+    }
+    TEST_CHECK((trace.ring.total == 4) && (sht40x_trace_count(&trace) == TEST_TRACE_SIZE));
+    TEST_CHECK(sht40x_start_measurement(pHandle, SHT40X_PRECISION_HIGH) == 0);
+    sht40x_vclock_advance_us(&test_clock, MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] * 1000UL);
+    test_devices[0].present = 0;
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == 1);
+    test_devices[0].present = 1;
+    test_devices[0].crc_error_every = 1;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == SHT40X_DRV_ERR_CRC);
+    test_devices[0].crc_error_every = 0;
+    DRIVER_SHT40X_LINK_TRACE(pHandle, NULL);
+
+    TEST_CHECK((trace.ring.total == 8) && (sht40x_trace_count(&trace) == TEST_TRACE_SIZE));
+    TEST_CHECK(sht40x_trace_get(&trace, TEST_TRACE_SIZE, &entry) == 1);
+    for(index = 0; index < TEST_TRACE_SIZE; index++)
+    {
+        TEST_CHECK((sht40x_trace_get(&trace, index, &entry) == 0) && (entry.sequence == 4U + index));
+        TEST_CHECK((entry.address == 0x44) && (entry.command == SHT40X_MEASURE_T_RH_HIGH_PREC_CMD));
+    }
+    TEST_CHECK((sht40x_trace_get(&trace, 1, &entry) == 0) && (entry.op_status == (SHT40X_TRACE_READ | 1)));
+    TEST_CHECK((entry.length == RESPONSE_LENGTH) && (entry.data[0] == 0) && (entry.data[5] == 0));
+    TEST_CHECK((sht40x_trace_get(&trace, 3, &entry) == 0) && (entry.op_status == SHT40X_TRACE_READ));
+    TEST_CHECK((sht40x_crc8(&entry.data[0], 2) != entry.data[2]) || (sht40x_crc8(&entry.data[3], 2) != entry.data[5]));
+
+    pDump = tmpfile();
+    TEST_CHECK(pDump != NULL);
+    if(pDump == NULL)
+        return;
+    TEST_CHECK(sht40x_trace_dump(&trace, NULL, pDump) == 2);
+    TEST_CHECK(sht40x_trace_dump(&trace, test_dump_output, pDump) == 0);
+    TEST_CHECK(ftell(pDump) == (long)(SHT40X_TRACE_HEADER_SIZE + (TEST_TRACE_SIZE * SHT40X_TRACE_ENTRY_SIZE)));
+    rewind(pDump);
+    TEST_CHECK(fread(pHeader, 1, sizeof(pHeader), pDump) == sizeof(pHeader));
+    TEST_CHECK(memcmp(pHeader, SHT40X_TRACE_MAGIC, 8) == 0);
+    TEST_CHECK((pHeader[8] == SHT40X_TRACE_ENTRY_SIZE) && (pHeader[10] == TEST_TRACE_SIZE) && (pHeader[12] == 4));
+
+    TEST_CHECK(test_decode(sht40x_trace_decode_main, pDump, text) == 0);
+    TEST_CHECK(strstr(text, "4 entries, 4 older entries overwritten") != NULL);
+    TEST_CHECK(strstr(text, "read  NACK  measure high") != NULL);
+    TEST_CHECK(strstr(text, "CRC error") != NULL);
+    snprintf(line, sizeof(line), "0x44   %8lu %8lu %8lu %8lu", 2UL, 1UL, 1UL, 1UL);
+    TEST_CHECK(strstr(text, line) != NULL);     /**< writes, reads, nacks, CRC errors */
+    fclose(pDump);
+}
+#endif // __linux__ && SHT40X_TRACE
+
+#if defined(__linux__) && defined(SHT40X_LOG)
+#define main sht40x_log_decode_main     /**< the decoder runs in process on the dump */
+#include "sht40x_log_decode.c"
+#undef main
+
+/**
+ * @brief log ring: driver events, wrap and lost entries decoded from the dump
+ */
+static void test_log(void)
+{
+    static char text[TEST_DECODE_TEXT_MAX];
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_log_entry_t entries[TEST_LOG_SIZE];
+    sht40x_log_entry_t entry;
+    sht40x_log_t log;
+    sht40x_data_t data;
+    uint8_t pHeader[SHT40X_LOG_HEADER_SIZE];
+    uint8_t pEntry[SHT40X_LOG_ENTRY_SIZE];
+    char line[64];
+    FILE *pDump;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_log_init(NULL, entries, TEST_LOG_SIZE) == 2);
+    TEST_CHECK(sht40x_log_init(&log, entries, TEST_LOG_SIZE - 1U) == 1);
+    TEST_CHECK(sht40x_log_init(&log, entries, TEST_LOG_SIZE) == 0);
+    TEST_CHECK((sht40x_log_count(&log) == 0) && (sht40x_log_get(&log, 0, &entry) == 1));
+    DRIVER_SHT40X_LINK_LOG(pHandle, &log);
+
+    /** 6 events in a ring of 4, a CRC error logs the failed read too */
+    TEST_CHECK(sht40x_soft_reset(pHandle) == 0);
+    TEST_CHECK(sht40x_fetch_measurement(pHandle, &data) == 1);
+    TEST_CHECK(sht40x_start_measurement(pHandle, (sht40x_precision_t)(SHT40X_PRECISION_LOWEST + 1)) == 1);
+    test_devices[0].crc_error_every = 1;
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_HIGH, &data) == SHT40X_DRV_ERR_CRC);
+    test_devices[0].crc_error_every = 0;
+    test_devices[0].present = 0;
+    sht40x_vclock_advance_us(&test_clock, 1000UL * 1000UL);
+    TEST_CHECK(sht40x_get_temp_rh(pHandle, SHT40X_PRECISION_MIDIUM, &data) == 1);
+    test_devices[0].present = 1;
+    DRIVER_SHT40X_LINK_LOG(pHandle, NULL);
+
+    TEST_CHECK((log.ring.total == 6) && (sht40x_log_count(&log) == TEST_LOG_SIZE));
+    TEST_CHECK(sht40x_log_get(&log, TEST_LOG_SIZE, &entry) == 1);
+    TEST_CHECK((sht40x_log_get(&log, 0, &entry) == 0) && (entry.event == SHT40X_LOG_INVALID_PRECISION) &&
+               (entry.argument == SHT40X_PRECISION_LOWEST + 1) && (entry.address == 0x44));
+    TEST_CHECK((sht40x_log_get(&log, 1, &entry) == 0) && (entry.event == SHT40X_LOG_CRC_ERROR));
+    TEST_CHECK((sht40x_log_get(&log, 2, &entry) == 0) && (entry.event == SHT40X_LOG_MEASURE_READ_FAILED) &&
+               (entry.argument == SHT40X_PRECISION_HIGH));
+    TEST_CHECK((sht40x_log_get(&log, 3, &entry) == 0) && (entry.event == SHT40X_LOG_MEASURE_CMD_FAILED) &&
+               (entry.argument == SHT40X_PRECISION_MIDIUM) && (entry.timestamp == sht40x_vclock_now_ms(&test_clock)));
+
+    pDump = tmpfile();
+    TEST_CHECK(pDump != NULL);
+    if(pDump == NULL)
+        return;
+    TEST_CHECK(sht40x_log_dump(&log, NULL, pDump) == 2);
+    TEST_CHECK(sht40x_log_dump(&log, test_dump_output, pDump) == 0);
+    TEST_CHECK(ftell(pDump) == (long)(SHT40X_LOG_HEADER_SIZE + (TEST_LOG_SIZE * SHT40X_LOG_ENTRY_SIZE)));
+    rewind(pDump);
+    TEST_CHECK(fread(pHeader, 1, sizeof(pHeader), pDump) == sizeof(pHeader));
+    TEST_CHECK(memcmp(pHeader, SHT40X_LOG_MAGIC, 8) == 0);
+    TEST_CHECK((pHeader[8] == SHT40X_LOG_ENTRY_SIZE) && (pHeader[10] == TEST_LOG_SIZE) && (pHeader[12] == 2));
+    TEST_CHECK(fseek(pDump, (long)(SHT40X_LOG_HEADER_SIZE + (3 * SHT40X_LOG_ENTRY_SIZE)), SEEK_SET) == 0);
+    TEST_CHECK(fread(pEntry, 1, sizeof(pEntry), pDump) == sizeof(pEntry));
+    TEST_CHECK((pEntry[0] == (uint8_t)entry.timestamp) && (pEntry[3] == (uint8_t)(entry.timestamp >> 24)));
+    TEST_CHECK((pEntry[4] == SHT40X_LOG_MEASURE_CMD_FAILED) && (pEntry[5] == 0x44) && (pEntry[6] == SHT40X_PRECISION_MIDIUM) && (pEntry[7] == 0));
+
+    TEST_CHECK(test_decode(sht40x_log_decode_main, pDump, text) == 0);
+    TEST_CHECK(strstr(text, "4 entries, 2 older entries overwritten") != NULL);
+    snprintf(line, sizeof(line), "invalid precision %u", (unsigned)(SHT40X_PRECISION_LOWEST + 1));
+    TEST_CHECK(strstr(text, line) != NULL);
+    TEST_CHECK(strstr(text, "CRC mismatch, received CRC bytes 0x") != NULL);
+    snprintf(line, sizeof(line), "failed to read temp and humidity, precision %u", (unsigned)SHT40X_PRECISION_HIGH);
+    TEST_CHECK(strstr(text, line) != NULL);
+    snprintf(line, sizeof(line), "failed to write temp and humidity cmd, precision %u", (unsigned)SHT40X_PRECISION_MIDIUM);
+    TEST_CHECK(strstr(text, line) != NULL);
+    TEST_CHECK((strstr(text, "soft reset") == NULL) && (strstr(text, "fetch without") == NULL));     /**< overwritten */
+    snprintf(line, sizeof(line), "0x44   %8lu %8lu", 4UL, 0UL);
+    TEST_CHECK(strstr(text, line) != NULL);     /**< errors, information */
+    fclose(pDump);
+}
+#endif // __linux__ && SHT40X_LOG
+
+/**
+ * @brief     tick a sampler once per virtual millisecond
+ * @param[in] *pSampler points to the sampler
+ * @param[in] u32Ms is the number of milliseconds to run
+ * @return    number of tick calls that reported a failed step
+ */
+static uint32_t test_sampler_run(sht40x_sampler_t *pSampler, uint32_t u32Ms)
+{
+    uint32_t u32Failed = 0;
+
+    while(u32Ms-- > 0)
+    {
+        if(sht40x_sampler_tick(pSampler, sht40x_vclock_now_ms(&test_clock)) != 0)
+            u32Failed++;
+        sht40x_vclock_advance_us(&test_clock, 1000UL);
+    }
+    return u32Failed;
+}
+
+/**
+ * @brief continuous sampler: period, re-alignment, busy retry, full ring and pop order
+ */
+static void test_sampler(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_sample_t buffer[TEST_RING_SIZE];
+    sht40x_sample_t sample;
+    sht40x_sampler_t sampler;
+    sht40x_ring_t ring;
+    uint32_t u32Now;
+    uint16_t u16Last;
+    uint8_t index;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_ring_init(&ring, buffer, 3) == 1);            /**< not a power of two */
+    TEST_CHECK(sht40x_ring_init(&ring, buffer, TEST_RING_SIZE) == 0);
+    TEST_CHECK(sht40x_sampler_init(&sampler, pHandle, &ring, (sht40x_precision_t)(SHT40X_PRECISION_LOWEST + 1), 10) == 1);
+    TEST_CHECK(sht40x_sampler_init(&sampler, pHandle, &ring, SHT40X_PRECISION_HIGH, 1) == 0);
+    TEST_CHECK(sampler.period_ms == MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH]);     /**< raised to the conversion time */
+
+    /** rising temperature, the samples must come out in measurement order */
+    test_devices[0].drift_mC_per_s = 1000;
+    TEST_CHECK(sht40x_sampler_init(&sampler, pHandle, &ring, SHT40X_PRECISION_HIGH, 20) == 0);
+    TEST_CHECK(sht40x_sampler_start(&sampler, sht40x_vclock_now_ms(&test_clock)) == 0);
+    TEST_CHECK(test_sampler_run(&sampler, 20 * TEST_RING_SIZE) == 0);
+    TEST_CHECK((sht40x_ring_count(&ring) == TEST_RING_SIZE) && (ring.overflow == 0));
+    TEST_CHECK(test_sampler_run(&sampler, 20 * 2) == 0);
+    TEST_CHECK((sht40x_ring_count(&ring) == TEST_RING_SIZE) && (ring.overflow == 2));      /**< full, counted */
+    u16Last = 0;
+    for(index = 0; index < TEST_RING_SIZE; index++)
+    {
+        TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+        TEST_CHECK(sample.temperature > u16Last);
+        u16Last = sample.temperature;
+    }
+    TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 1);               /**< empty */
+
+    /** after a stall the sampler re-aligns on the current tick instead of catching up */
+    sht40x_vclock_advance_us(&test_clock, 20UL * 10UL * 1000UL);
+    u32Now = sht40x_vclock_now_ms(&test_clock);
+    TEST_CHECK(test_sampler_run(&sampler, 20) == 0);
+    TEST_CHECK(sampler.next_tick == u32Now + 20);
+    TEST_CHECK(sht40x_ring_count(&ring) == 1);
+
+    /** a device slower than the datasheet is retried after a busy NACK */
+    (void)sht40x_ring_init(&ring, buffer, TEST_RING_SIZE);
+    test_devices[0].conversion_us[SHT40X_PRECISION_HIGH] = (MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH] + 2UL) * 1000UL;
+    test_devices[0].nacks = 0;
+    TEST_CHECK(sht40x_set_ready_poll(pHandle, SHT40X_BOOL_TRUE) == 0);
+    TEST_CHECK(sht40x_sampler_init(&sampler, pHandle, &ring, SHT40X_PRECISION_HIGH, 20) == 0);
+    TEST_CHECK(sht40x_sampler_start(&sampler, sht40x_vclock_now_ms(&test_clock)) == 0);
+    TEST_CHECK(test_sampler_run(&sampler, 20) == 0);
+    TEST_CHECK(test_devices[0].nacks != 0);
+    TEST_CHECK((sampler.errors == 0) && (sht40x_ring_count(&ring) == 1));
+    TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+    TEST_CHECK((sht40x_sample_temperature_mC(&sample) > test_devices[0].temperature_mC));    /**< drifted up, not a stale frame */
+}
+
+#if defined(SHT40X_SAMPLE_DELTA) || defined(SHT40X_SAMPLE_FLAGS)
+/**
+ * @brief sample delta and flags: first sample, samples dropped on a full ring and a stall
+ */
+static void test_sample_meta(void)
+{
+    sht40x_handle_t *pHandle = &test_handles[0];
+    sht40x_sample_t buffer[TEST_RING_SIZE];
+    sht40x_sample_t sample;
+    sht40x_sampler_t sampler;
+    sht40x_ring_t ring;
+    uint8_t index;
+
+    test_setup(1);
+    TEST_CHECK(sht40x_ring_init(&ring, buffer, TEST_RING_SIZE) == 0);
+    TEST_CHECK(sht40x_sampler_init(&sampler, pHandle, &ring, SHT40X_PRECISION_HIGH, 20) == 0);
+    TEST_CHECK(sht40x_sampler_start(&sampler, sht40x_vclock_now_ms(&test_clock)) == 0);
+    TEST_CHECK(test_sampler_run(&sampler, 20 * TEST_RING_SIZE) == 0);
+    TEST_CHECK(sht40x_ring_count(&ring) == TEST_RING_SIZE);
+    for(index = 0; index < TEST_RING_SIZE; index++)
+    {
+        TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+#ifdef SHT40X_SAMPLE_DELTA
+        TEST_CHECK(sample.delta_ms == ((index == 0) ? 0U : 20U));          /**< the first one counts from the start */
+#endif // SHT40X_SAMPLE_DELTA
+#ifdef SHT40X_SAMPLE_FLAGS
+        TEST_CHECK(sample.flags == ((index == 0) ? SHT40X_SAMPLE_FLAG_FIRST : 0U));
+#endif // SHT40X_SAMPLE_FLAGS
+    }
+
+    /** two samples dropped on a full ring, the next stored one spans them */
+    TEST_CHECK(test_sampler_run(&sampler, 20 * TEST_RING_SIZE) == 0);
+    TEST_CHECK(test_sampler_run(&sampler, 20 * 2) == 0);
+    TEST_CHECK((sht40x_ring_count(&ring) == TEST_RING_SIZE) && (ring.overflow == 2));
+    TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+    TEST_CHECK(test_sampler_run(&sampler, 20) == 0);
+    TEST_CHECK(sht40x_ring_count(&ring) == TEST_RING_SIZE);
+    for(index = 0; index < TEST_RING_SIZE; index++)
+        TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+#ifdef SHT40X_SAMPLE_DELTA
+    TEST_CHECK(sample.delta_ms == 20U * 3U);
+#endif // SHT40X_SAMPLE_DELTA
+#ifdef SHT40X_SAMPLE_FLAGS
+    TEST_CHECK(sample.flags == SHT40X_SAMPLE_FLAG_LOST);
+#endif // SHT40X_SAMPLE_FLAGS
+
+    /** a stall longer than the delta range saturates it, the gap flag goes with it */
+    sht40x_vclock_advance_us(&test_clock, 70000UL * 1000UL);
+    TEST_CHECK(test_sampler_run(&sampler, 20 * 2) == 0);
+    TEST_CHECK(sht40x_ring_count(&ring) == 2);
+    TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+#ifdef SHT40X_SAMPLE_DELTA
+    TEST_CHECK(sample.delta_ms == 0xFFFFU);
+#ifdef SHT40X_SAMPLE_FLAGS
+    TEST_CHECK(sample.flags == SHT40X_SAMPLE_FLAG_GAP);
+#endif // SHT40X_SAMPLE_FLAGS
+#endif // SHT40X_SAMPLE_DELTA
+    TEST_CHECK(sht40x_ring_pop(&ring, &sample) == 0);
+#ifdef SHT40X_SAMPLE_DELTA
+    TEST_CHECK(sample.delta_ms == 20U);
+#endif // SHT40X_SAMPLE_DELTA
+#ifdef SHT40X_SAMPLE_FLAGS
+    TEST_CHECK(sample.flags == 0U);
+#endif // SHT40X_SAMPLE_FLAGS
+}
+#endif // SHT40X_SAMPLE_DELTA || SHT40X_SAMPLE_FLAGS
+
+/**
+ * @brief     feed one sample to a filter
+ * @param[in] *pFilter points to the filter
+ * @param[in] u16Temperature is the temperature ticks of the sample
+ * @param[in] u16Humidity is the humidity ticks of the sample
+ * @param[out] *pOut points to the filter output
+ * @return    status of sht40x_filter_push
+ */
+static uint8_t test_filter_feed(sht40x_filter_t *pFilter, uint16_t u16Temperature, uint16_t u16Humidity, sht40x_sample_t *pOut)
+{
+    sht40x_sample_t sample;
+
+    memset(&sample, 0, sizeof(sample));
+    sample.temperature = u16Temperature;
+    sample.humidity = u16Humidity;
+    return sht40x_filter_push(pFilter, &sample, pOut);
+}
+
+/**
+ * @brief boxcar, EMA and median filters on known inputs, averaged blocking read
+ */
+static void test_filter(void)
+{
+    static const uint16_t pTicks[4] = { 0x6000, 0x6001, 0x6004, 0x6006 };
+    sht40x_filter_t filter;
+    sht40x_sample_t out;
+    sht40x_mock_t mock;
+    sht40x_handle_t handle;
+    sht40x_data_t data;
+    uint32_t u32Start;
+    uint8_t index;
+
+    TEST_CHECK(sht40x_filter_init(NULL, SHT40X_FILTER_BOXCAR, 4) == 2);
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_BOXCAR, 0) == 1);
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_EMA, SHT40X_FILTER_EMA_SHIFT_MAX + 1) == 1);
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_MEDIAN, 4) == 1);          /**< even window */
+    TEST_CHECK(sht40x_filter_init(&filter, (sht40x_filter_type_t)3, 1) == 1);
+
+    /** boxcar: one rounded average every 4 inputs */
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_BOXCAR, 4) == 0);
+    TEST_CHECK(sht40x_filter_push(&filter, NULL, &out) == 2);
+    TEST_CHECK(sht40x_filter_push(NULL, &out, &out) == 2);
+    TEST_CHECK(test_filter_feed(&filter, 100, 0, &out) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(test_filter_feed(&filter, 200, 0, &out) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(test_filter_feed(&filter, 300, 0, &out) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(test_filter_feed(&filter, 401, 3, &out) == 0);
+    TEST_CHECK((out.temperature == 250) && (out.humidity == 1));
+    TEST_CHECK(test_filter_feed(&filter, 7, 7, &out) == SHT40X_DRV_NOT_READY);      /**< next block */
+
+    /** EMA 1/2: seeded by the first input, then halfway to each new one */
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_EMA, 1) == 0);
+    TEST_CHECK((test_filter_feed(&filter, 100, 1000, &out) == 0) && (out.temperature == 100) && (out.humidity == 1000));
+    TEST_CHECK((test_filter_feed(&filter, 200, 0, &out) == 0) && (out.temperature == 150) && (out.humidity == 500));
+    TEST_CHECK((test_filter_feed(&filter, 200, 0, &out) == 0) && (out.temperature == 175) && (out.humidity == 250));
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_EMA, 2) == 0);
+    TEST_CHECK((test_filter_feed(&filter, 0, 0, &out) == 0) && (test_filter_feed(&filter, 256, 0, &out) == 0) && (out.temperature == 64));
+
+    /** median of 3: silent until the window is full, then rejects a single spike */
+    TEST_CHECK(sht40x_filter_init(&filter, SHT40X_FILTER_MEDIAN, 3) == 0);
+    TEST_CHECK(test_filter_feed(&filter, 5, 50, &out) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK(test_filter_feed(&filter, 1, 10, &out) == SHT40X_DRV_NOT_READY);
+    TEST_CHECK((test_filter_feed(&filter, 9, 90, &out) == 0) && (out.temperature == 5) && (out.humidity == 50));
+    TEST_CHECK((test_filter_feed(&filter, 2, 20, &out) == 0) && (out.temperature == 2) && (out.humidity == 20));
+    TEST_CHECK((test_filter_feed(&filter, 60000, 60000, &out) == 0) && (out.temperature == 9) && (out.humidity == 90));
+    TEST_CHECK(sht40x_filter_reset(&filter) == 0);
+    TEST_CHECK(test_filter_feed(&filter, 5, 50, &out) == SHT40X_DRV_NOT_READY);
+
+    /** n samples taken back to back and averaged on ticks */
+    test_setup(1);
+    (void)sht40x_mock_init(&mock, 0);
+    for(index = 0; index < 4; index++)
+    {
+        (void)sht40x_mock_expect_measurement(&mock, 0x44, READ_PRECISION[SHT40X_PRECISION_HIGH], pTicks[index], (uint16_t)(0x8000 + index));
+    }
+    test_link(&handle, 0x44, 1);
+    DRIVER_SHT40X_LINK_I2C_INIT(&handle, sht40x_mock_i2c_init);
+    DRIVER_SHT40X_LINK_I2C_DEINIT(&handle, sht40x_mock_i2c_deinit);
+    DRIVER_SHT40X_LINK_I2C_READ(&handle, sht40x_mock_i2c_read);
+    DRIVER_SHT40X_LINK_I2C_WRITE(&handle, sht40x_mock_i2c_write);
+    DRIVER_SHT40X_LINK_I2C_BUS(&handle, &mock);
+    TEST_CHECK(sht40x_init(&handle) == 0);
+    TEST_CHECK(sht40x_basic_get_temp_humidity_nSample(&handle, SHT40X_PRECISION_HIGH, &data, 0) == 1);
+    u32Start = sht40x_vclock_now_ms(&test_clock);
+    TEST_CHECK(sht40x_basic_get_temp_humidity_nSample(&handle, SHT40X_PRECISION_HIGH, &data, 4) == 0);
+    TEST_CHECK(sht40x_vclock_now_ms(&test_clock) - u32Start <= 4U * MEASUREMENT_DELAY[SHT40X_PRECISION_HIGH]);     /**< no pause between samples */
+    TEST_CHECK(sht40x_temperature_mC(&data) == sht40x_convert_temperature_mC(0x6003));      /**< (0x6000 + 0x6001 + 0x6004 + 0x6006 + 2) / 4 */
+    TEST_CHECK(sht40x_humidity_mRH(&data) == sht40x_convert_humidity_mRH(0x8002));           /**< (0x8000 + ... + 0x8003 + 2) / 4 */
+    TEST_CHECK(sht40x_mock_verify(&mock) == 0);
+}
+
+#ifdef __linux__
+/**
+ * @brief async case state, the callback hands its results over under the lock
+ */
+typedef struct test_async_s
+{
+    pthread_mutex_t lock;                               /**< protects the fields below */
+    pthread_cond_t done;                                /**< signaled when the chain ended */
+    uint8_t finished;                                   /**< chain ended */
+    uint8_t measurements;                               /**< operations completed */
+    uint8_t errors;                                     /**< operations failed or with bad data */
+} test_async_t;
+
+/**
+ * @brief     monotonic clock of the sim bus in the async case
+ */
+static uint64_t test_now_us(void *pContext)
+{
+    struct timespec ts;
+
+    (void)pContext;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000ULL) + ((uint64_t)ts.tv_nsec / 1000ULL);
+}
+
+/**
+ * @brief async completion, chains TEST_ASYNC_MEASUREMENTS measurements from the worker thread
+ */
+static void test_async_callback(sht40x_async_t *pAsync, uint8_t u8Status)
+{
+    test_async_t *pTest = (test_async_t *)pAsync->pContext;
+    sht40x_data_t data;
+    uint8_t u8Next = 0;
+
+    pthread_mutex_lock(&pTest->lock);
+    if((u8Status != 0) || (sht40x_async_get_data(pAsync, &data) != 0) || !test_near(&data, &test_devices[0], 0))
+        pTest->errors++;
+    pTest->measurements++;
+    if(pTest->measurements < TEST_ASYNC_MEASUREMENTS)
+        u8Next = 1;
+    pthread_mutex_unlock(&pTest->lock);
+
+    if((u8Next == 1) && (sht40x_async_start_measurement(pAsync, SHT40X_PRECISION_HIGH) == 0))
+        return;     /**< the next completion reports */
+
+    pthread_mutex_lock(&pTest->lock);
+    pTest->finished = 1;
+    pthread_cond_signal(&pTest->done);
+    pthread_mutex_unlock(&pTest->lock);
+}
+
+/**
+ * @brief completion-driven measurements through the worker thread transport
+ */
+static void test_async(void)
+{
+    sht40x_async_thread_t worker;
+    sht40x_async_t async;
+    test_async_t test;
+    sht40x_ticks_t ticks;
+#ifdef SHT40X_STATS
+    uint32_t u32Commands;
+#endif // SHT40X_STATS
+
+    test_setup(0);
+    test_bus.now_us = test_now_us;      /**< the worker sleeps in real time */
+    TEST_CHECK(sht40x_set_ready_poll(&test_handles[0], SHT40X_BOOL_TRUE) == 0);
+#ifdef SHT40X_STATS
+    u32Commands = test_handles[0].stats.cmd_measure[SHT40X_PRECISION_HIGH];
+#endif // SHT40X_STATS
+    memset(&test, 0, sizeof(test));
+    pthread_mutex_init(&test.lock, NULL);
+    pthread_cond_init(&test.done, NULL);
+
+    TEST_CHECK(sht40x_async_thread_start(&worker, &test_bus, sht40x_sim_i2c_read, sht40x_sim_i2c_write) == 0);
+    TEST_CHECK(sht40x_async_init(&async, &test_handles[0], &worker.transport, test_async_callback, &test) == 0);
+
+    pthread_mutex_lock(&test.lock);
+    TEST_CHECK(sht40x_async_start_measurement(&async, SHT40X_PRECISION_HIGH) == 0);
+    TEST_CHECK(sht40x_async_start_measurement(&async, SHT40X_PRECISION_HIGH) == 1);     /**< busy */
+    while(test.finished == 0)
+        pthread_cond_wait(&test.done, &test.lock);
+    TEST_CHECK(test.measurements == TEST_ASYNC_MEASUREMENTS);
+    TEST_CHECK(test.errors == 0);
+    TEST_CHECK(test_handles[0].conversion_ms[SHT40X_PRECISION_HIGH] != 0);     /**< learned through the hook */
+#ifdef SHT40X_STATS
+    TEST_CHECK(test_handles[0].stats.cmd_measure[SHT40X_PRECISION_HIGH] - u32Commands == TEST_ASYNC_MEASUREMENTS);
+#endif // SHT40X_STATS
+    pthread_mutex_unlock(&test.lock);
+
+    TEST_CHECK(sht40x_async_thread_stop(&worker) == 0);
+    TEST_CHECK(sht40x_async_get_ticks(&async, &ticks) == 0);
+    TEST_CHECK(sht40x_async_start_measurement(&async, SHT40X_PRECISION_HIGH) == 1);     /**< worker stopped */
+
+    pthread_cond_destroy(&test.done);
+    pthread_mutex_destroy(&test.lock);
+}
+
+/**
+ * @brief     i2c-dev stand-in, runs the messages of I2C_RDWR on the sim bus
+ * @note      stops at the first NACK like the kernel, the messages ahead of it reached the devices
+ */
+int ioctl(int fd, unsigned long request, ...)
+{
+    struct i2c_rdwr_ioctl_data *pXfer;
+    struct i2c_msg *pMsg;
+    va_list args;
+    uint32_t index;
+    uint8_t err;
+
+    va_start(args, request);
+    pXfer = va_arg(args, struct i2c_rdwr_ioctl_data *);
+    va_end(args);
+    if((fd != TEST_LINUX_FD) || (request != I2C_RDWR))
+    {
+        errno = ENOTTY;
+        return -1;
+    }
+
+    for(index = 0; index < pXfer->nmsgs; index++)
+    {
+        pMsg = &pXfer->msgs[index];
+        if((pMsg->flags & I2C_M_RD) != 0)
+        {
+            if((linux_flaky_read == 1) && (pXfer->nmsgs > 1) && (pMsg->addr == 0x45))
+            {
+                linux_flaky_read = 0;
+                err = 1;
+            }
+            else
+            {
+                err = sht40x_sim_i2c_read(&test_bus, (uint8_t)pMsg->addr, pMsg->buf, (uint8_t)pMsg->len);
+            }
+        }
+        else
+        {
+            err = sht40x_sim_i2c_write(&test_bus, (uint8_t)pMsg->addr, pMsg->buf, (uint8_t)pMsg->len);
+        }
+        if(err != 0)
+        {
+            errno = EREMOTEIO;
+            return -1;
+        }
+    }
+    return (int)pXfer->nmsgs;
+}
+
+/**
+ * @brief batched group read of the linux transport, sensor missing and sensor NACKing the batch
+ */
+static void test_linux(void)
+{
+    const uint8_t pAddr[TEST_SENSORS] = { 0x44, 0x45, 0x46 };
+    sht40x_linux_bus_t bus;
+    sht40x_data_t data[TEST_SENSORS];
+    uint8_t pStatus[TEST_SENSORS];
+    uint8_t index;
+
+    test_setup(0);
+    test_bus.now_us = test_now_us;      /**< the transport sleeps in real time */
+    (void)sht40x_linux_bus_init(&bus, 0);
+    bus.fd = TEST_LINUX_FD;
+
+    TEST_CHECK(sht40x_linux_group_get_temp_rh(&bus, pAddr, TEST_SENSORS, SHT40X_PRECISION_HIGH, data, pStatus) == 0);
+    TEST_CHECK(bus.syscalls == 2);
+    for(index = 0; index < TEST_SENSORS; index++)
+    {
+        TEST_CHECK((pStatus[index] == 0) && test_near(&data[index], &test_devices[index], 0));
+    }
+
+    /** 0x44 took the batched command and is converting when it is written again */
+    test_devices[1].present = 0;
+    TEST_CHECK(sht40x_linux_group_get_temp_rh(&bus, pAddr, TEST_SENSORS, SHT40X_PRECISION_HIGH, data, pStatus) == 1);
+    TEST_CHECK((pStatus[0] == 0) && (pStatus[1] == 1) && (pStatus[2] == 0));
+    TEST_CHECK(test_near(&data[0], &test_devices[0], 0) && test_near(&data[2], &test_devices[2], 0));
+    test_devices[1].present = 1;
+
+    /** 0x44 handed its result to the failed batch, it must be measured again */
+    linux_flaky_read = 1;
+    TEST_CHECK(sht40x_linux_group_get_temp_rh(&bus, pAddr, TEST_SENSORS, SHT40X_PRECISION_HIGH, data, pStatus) == 0);
+    for(index = 0; index < TEST_SENSORS; index++)
+    {
+        TEST_CHECK((pStatus[index] == 0) && test_near(&data[index], &test_devices[index], 0));
+    }
+
+    bus.syscalls = 0;
+    TEST_CHECK(sht40x_linux_group_get_temp_rh(&bus, pAddr, TEST_SENSORS, (sht40x_precision_t)(SHT40X_PRECISION_LOWEST + 1),
+                                              data, pStatus) == 2);
+    TEST_CHECK(bus.syscalls == 0);      /**< nothing sent */
+}
+#endif // __linux__
+
+/**
+ * @brief     run one case and print its result
+ * @param[in] name is the case name
+ * @param[in] run is the case
+ */
+static void test_run(const char *name, void (*run)(void))
+{
+    unsigned long before = failures;
+
+    run();
+    printf("%-12s %s\n", name, (failures == before) ? "ok" : "FAILED");
+}
+
+int main(void)
+{
+    test_run("blocking", test_blocking);
+    test_run("split_phase", test_split_phase);
+    test_run("heater", test_heater);
+    test_run("group", test_group);
+    test_run("fleet", test_fleet);
+    test_run("mux", test_mux);
+    test_run("poll", test_poll);
+    test_run("mock", test_mock);
+#ifdef SHT40X_STATS
+    test_run("stats", test_stats);
+#endif // SHT40X_STATS
+    test_run("sampler", test_sampler);
+#if defined(SHT40X_SAMPLE_DELTA) || defined(SHT40X_SAMPLE_FLAGS)
+    test_run("sample_meta", test_sample_meta);
+#endif // SHT40X_SAMPLE_DELTA || SHT40X_SAMPLE_FLAGS
+    test_run("filter", test_filter);
+    test_run("lut", test_lut);
+#ifdef SHT40X_ALARM
+    test_run("alarm", test_alarm);
+#endif // SHT40X_ALARM
+#ifdef __linux__
+    test_run("async", test_async);
+    test_run("linux", test_linux);
+#ifdef SHT40X_TRACE
+    test_run("trace", test_trace);
+#endif // SHT40X_TRACE
+#ifdef SHT40X_LOG
+    test_run("log", test_log);
+#endif // SHT40X_LOG
+#endif // __linux__
+
+    printf("\n%lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
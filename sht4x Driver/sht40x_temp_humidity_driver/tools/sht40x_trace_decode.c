@@ -0,0 +1,181 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * File:   sht40x_trace_decode.c
+ * Author: Cedric Akilimali
+ *
+ * Created on October 18, 2026, 4:30 PM
+ */
+
+/**
+ * Host decoder of the dumps written by sht40x_trace_dump (sht40x_driver_trace.h).
+ *
+ * usage: sht40x_trace_decode [FILE]
+ *
+ * FILE is the raw binary dump, or the same bytes as hex text (e.g. captured from a
+ * serial console), standard input when omitted. Prints one line per transaction with
+ * the command name, the time since the previous transaction, the CRC check of every
+ * word read and the decoded measurement or serial number, then a per address summary.
+ */
+
+#include "../sht40x_driver.h"
+#include "../sht40x_driver_trace.h"
+#include "sht40x_decode.h"
+
+/**
+ * @brief per address summary
+ */
+typedef struct decode_summary_s
+{
+    unsigned long writes;                               /**< commands written */
+    unsigned long reads;                                /**< responses read */
+    unsigned long nacks;                                /**< failed transfers */
+    unsigned long crc_errors;                           /**< responses with a bad CRC */
+} decode_summary_t;
+
+static decode_summary_t summary[128];
+
+/**
+ * @brief     name a command byte
+ */
+static const char *decode_command(uint8_t u8Cmd)
+{
+    switch(u8Cmd)
+    {
+        case SHT40X_MEASURE_T_RH_HIGH_PREC_CMD:      return "measure high";
+        case SHT40X_MEASURE_T_RH_MIDIUM_PREC_CMD:    return "measure medium";
+        case SHT40X_MEASURE_T_RH_LOWEST_PREC_CMD:    return "measure lowest";
+        case SHT40X_ACTIVATE_HEATER_200mW_1_S_CMD:   return "heater 200mW 1s";
+        case SHT40X_ACTIVATE_HEATER_200mW_100mS_CMD: return "heater 200mW 0.1s";
+        case SHT40X_ACTIVATE_HEATER_110mW_1_S_CMD:   return "heater 110mW 1s";
+        case SHT40X_ACTIVATE_HEATER_110mW_100mS_CMD: return "heater 110mW 0.1s";
+        case SHT40X_ACTIVATE_HEATER_20mW_1_S_CMD:    return "heater 20mW 1s";
+        case SHT40X_ACTIVATE_HEATER_20mW_100mS_CMD:  return "heater 20mW 0.1s";
+        case SHT40X_READ_SERIAL_NUMBER_CMD:          return "serial number";
+        case SHT40X_SOFT_RESET_CMD:                  return "soft reset";
+        default:                                     return "unknown";
+    }
+}
+
+/**
+ * @brief     print one transaction
+ */
+static void decode_entry(const uint8_t *pEntry, uint32_t u32Previous, int first)
+{
+    uint32_t u32Time = decode_get32(&pEntry[0]);
+    uint8_t u8Address = pEntry[4] & 0x7F;
+    uint8_t u8Read = pEntry[5] & SHT40X_TRACE_READ;
+    uint8_t u8Status = pEntry[5] & SHT40X_TRACE_STATUS_MASK;
+    uint8_t u8Cmd = pEntry[6];
+    uint8_t u8Length = pEntry[7];
+    const uint8_t *pData = &pEntry[8];
+    uint8_t u8Keep = (u8Length > SHT40X_TRACE_DATA_MAX) ? SHT40X_TRACE_DATA_MAX : u8Length;
+    uint8_t u8CrcOk;
+    uint8_t index;
+
+    printf("%6u %10lu %+7ld  0x%02X  %-5s %-4s  %-18s ", (unsigned)decode_get16(&pEntry[14]), (unsigned long)u32Time,
+           first ? 0L : (long)(int32_t)(u32Time - u32Previous), u8Address, u8Read ? "read" : "write",
+           u8Status ? "NACK" : "ok", decode_command(u8Cmd));
+
+    if(u8Status != 0)
+    {
+        summary[u8Address].nacks++;
+        printf("\n");
+        return;
+    }
+    if(u8Read == 0)
+    {
+        summary[u8Address].writes++;
+        printf("%02X\n", pData[0]);
+        return;
+    }
+
+    summary[u8Address].reads++;
+    for(index = 0; index < SHT40X_TRACE_DATA_MAX; index++)
+    {
+        if(index < u8Keep)
+            printf("%02X ", pData[index]);
+        else
+            printf("   ");
+    }
+    if(u8Keep < RESPONSE_LENGTH)
+    {
+        printf("\n");
+        return;
+    }
+
+    u8CrcOk = (sht40x_crc8(&pData[0], 2) == pData[2]) && (sht40x_crc8(&pData[3], 2) == pData[5]);
+    if(u8CrcOk == 0)
+    {
+        summary[u8Address].crc_errors++;
+        printf(" CRC error\n");
+        return;
+    }
+
+    if(u8Cmd == SHT40X_READ_SERIAL_NUMBER_CMD)
+    {
+        printf(" S/N %08lX\n", (unsigned long)(((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) | ((uint32_t)pData[3] << 8) | pData[4]));
+    }
+    else if(strcmp(decode_command(u8Cmd), "unknown") != 0)
+    {
+        int32_t i32Temperature = sht40x_convert_temperature_mC((uint16_t)((pData[0] << 8) | pData[1]));
+        int32_t i32Humidity = sht40x_convert_humidity_mRH((uint16_t)((pData[3] << 8) | pData[4]));
+
+        printf(" T %.3f C  RH %.3f %%\n", i32Temperature / 1000.0, i32Humidity / 1000.0);
+    }
+    else
+    {
+        printf("\n");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t pDump[DECODE_DUMP_MAX];
+    uint16_t u16EntrySize;
+    uint16_t u16Count;
+    uint32_t u32Previous = 0;
+    unsigned long index;
+
+    if(decode_read(argc, argv, SHT40X_TRACE_MAGIC, SHT40X_TRACE_ENTRY_SIZE, "trace", pDump, &u16EntrySize, &u16Count) != 0)
+        return 1;
+
+    printf("%lu entries, %lu older entries overwritten\n\n", (unsigned long)u16Count, (unsigned long)decode_get32(&pDump[12]));
+    printf("%6s %10s %7s  %-4s  %-5s %-4s  %-18s %s\n", "seq", "time_ms", "dt", "addr", "op", "st", "command", "bytes");
+    for(index = 0; index < u16Count; index++)
+    {
+        const uint8_t *pEntry = &pDump[SHT40X_TRACE_HEADER_SIZE + (index * u16EntrySize)];
+
+        decode_entry(pEntry, u32Previous, index == 0);
+        u32Previous = decode_get32(&pEntry[0]);
+    }
+
+    printf("\n%-6s %8s %8s %8s %8s\n", "addr", "writes", "reads", "nacks", "crc_err");
+    for(index = 0; index < 128; index++)
+    {
+        if((summary[index].writes + summary[index].reads + summary[index].nacks) == 0)
+            continue;
+        printf("0x%02lX   %8lu %8lu %8lu %8lu\n", index, summary[index].writes, summary[index].reads,
+               summary[index].nacks, summary[index].crc_errors);
+    }
+
+    return 0;
+}